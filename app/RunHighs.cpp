@@ -16,6 +16,7 @@
 #include "Highs.h"
 //#include "io/HighsIO.h"
 #include "lp_data/HighsRuntimeOptions.h"
+#include "parallel/HighsParallel.h"
 
 void reportModelStatsOrError(const HighsLogOptions& log_options,
                              const HighsStatus read_status,
@@ -47,6 +48,10 @@ int main(int argc, char** argv) {
   // settings defined in any options file.
   highs.passOptions(loaded_options);
 
+  // Start the global scheduler, as HiGHS would when solving the model, so
+  // that the MPS file reader can parse the COLUMNS section concurrently
+  highs::parallel::initialize_scheduler(options.threads);
+
   // Load the model from model_file
   HighsStatus read_status = highs.readModel(model_file);
   reportModelStatsOrError(log_options, read_status, highs.getModel());
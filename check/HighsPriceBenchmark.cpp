@@ -0,0 +1,110 @@
+// Microbenchmark for the PRICE kernels in util/HighsPriceKernels.h
+//
+// Usage: price_benchmark [model_file [num_repeat]]
+//
+// Times column-wise PRICE with a dense vector and row-wise PRICE into
+// a dense result, for each instruction set supported by the build and
+// the CPU, reporting the speedup over the scalar kernels.
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Highs.h"
+#include "util/HighsPriceKernels.h"
+
+int main(int argc, char** argv) {
+  std::string model_file =
+      argc > 1 ? argv[1]
+               : std::string(HIGHS_DIR) + "/check/instances/80bau3b.mps";
+  const int num_repeat = argc > 2 ? atoi(argv[2]) : 1000;
+
+  Highs highs;
+  highs.setOptionValue("output_flag", false);
+  if (highs.readModel(model_file) != HighsStatus::kOk) {
+    printf("Cannot read %s\n", model_file.c_str());
+    return 1;
+  }
+  HighsSparseMatrix a_matrix = highs.getLp().a_matrix_;
+  a_matrix.ensureColwise();
+  HighsSparseMatrix ar_matrix;
+  ar_matrix.createRowwise(a_matrix);
+  const HighsInt num_col = a_matrix.num_col_;
+  const HighsInt num_row = a_matrix.num_row_;
+  printf("Model %s: %d rows, %d columns, %d nonzeros\n", model_file.c_str(),
+         (int)num_row, (int)num_col, (int)a_matrix.numNz());
+
+  // Dense vector for column-wise PRICE, and a sparse one for row-wise
+  // PRICE into a dense result
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  std::vector<double> x(num_row);
+  std::vector<HighsInt> row_index;
+  for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+    x[iRow] = distribution(generator);
+    if (distribution(generator) < -0.8) row_index.push_back(iRow);
+  }
+
+  std::vector<double> result_array(num_col);
+  std::vector<HighsInt> result_index(num_col);
+  std::vector<double> dense_result(num_col);
+  std::vector<double> scalar_array;
+  std::vector<double> scalar_dense_result;
+  double scalar_column_time = 0;
+  double scalar_row_time = 0;
+
+  std::vector<HighsSimdLevel> levels = {HighsSimdLevel::kScalar};
+  if (highsSimdLevel() >= HighsSimdLevel::kAvx2)
+    levels.push_back(HighsSimdLevel::kAvx2);
+  if (highsSimdLevel() >= HighsSimdLevel::kAvx512)
+    levels.push_back(HighsSimdLevel::kAvx512);
+  using clock = std::chrono::steady_clock;
+  for (HighsSimdLevel level : levels) {
+    auto start = clock::now();
+    for (int k = 0; k < num_repeat; k++)
+      highsPriceByColumn(level, num_col, a_matrix.start_.data(),
+                         a_matrix.index_.data(), a_matrix.value_.data(),
+                         x.data(), result_array.data(), result_index.data());
+    double column_time =
+        std::chrono::duration<double>(clock::now() - start).count();
+
+    start = clock::now();
+    for (int k = 0; k < num_repeat; k++) {
+      std::fill(dense_result.begin(), dense_result.end(), 0);
+      highsPriceByRowDenseResult(
+          level, row_index.size(), row_index.data(), x.data(),
+          ar_matrix.start_.data(), ar_matrix.start_.data() + 1,
+          ar_matrix.index_.data(), ar_matrix.value_.data(),
+          dense_result.data());
+    }
+    double row_time =
+        std::chrono::duration<double>(clock::now() - start).count();
+
+    if (level == HighsSimdLevel::kScalar) {
+      scalar_column_time = column_time;
+      scalar_row_time = row_time;
+      scalar_array = result_array;
+      scalar_dense_result = dense_result;
+    }
+    double max_column_difference = 0;
+    HighsInt num_row_difference = 0;
+    for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+      max_column_difference =
+          std::max(std::fabs(result_array[iCol] - scalar_array[iCol]),
+                   max_column_difference);
+      num_row_difference += dense_result[iCol] != scalar_dense_result[iCol];
+    }
+    printf(
+        "%-8s column-wise %8.3f ms (speedup %5.2f, max difference %g); "
+        "row-wise %8.3f ms (speedup %5.2f, %d differences)\n",
+        highsSimdLevelName(level), 1e3 * column_time / num_repeat,
+        scalar_column_time / column_time, max_column_difference,
+        1e3 * row_time / num_repeat, scalar_row_time / row_time,
+        (int)num_row_difference);
+  }
+  return 0;
+}
@@ -0,0 +1,66 @@
+// Benchmark for the iteration throughput of dual simplex
+//
+// Usage: simplex_benchmark [model_file [num_repeat]]
+//
+// Solves the model from a logical basis with each value of the
+// simplex_prefetch_distance option, reporting the simplex iterations
+// per second and the speedup over no prefetching. Prefetching
+// doesn't change the arithmetic, so the iteration counts must agree.
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "Highs.h"
+
+int main(int argc, char** argv) {
+  std::string model_file =
+      argc > 1 ? argv[1]
+               : std::string(HIGHS_DIR) + "/check/instances/80bau3b.mps";
+  const int num_repeat = argc > 2 ? atoi(argv[2]) : 3;
+
+  Highs highs;
+  highs.setOptionValue("output_flag", false);
+  if (highs.readModel(model_file) != HighsStatus::kOk) {
+    printf("Cannot read %s\n", model_file.c_str());
+    return 1;
+  }
+  highs.setOptionValue("presolve", "off");
+  highs.setOptionValue("simplex_strategy", kSimplexStrategyDual);
+  const HighsLp& lp = highs.getLp();
+  printf("Model %s: %d rows, %d columns, %d nonzeros\n", model_file.c_str(),
+         (int)lp.num_row_, (int)lp.num_col_, (int)lp.a_matrix_.numNz());
+
+  std::vector<HighsInt> prefetch_distances = {0, 4, 8, 16, 32};
+  using clock = std::chrono::steady_clock;
+  double base_rate = 0;
+  HighsInt base_iteration_count = -1;
+  for (HighsInt prefetch_distance : prefetch_distances) {
+    highs.setOptionValue("simplex_prefetch_distance", prefetch_distance);
+    HighsInt iteration_count = 0;
+    double time = 0;
+    for (int k = 0; k < num_repeat; k++) {
+      highs.clearSolver();
+      auto start = clock::now();
+      if (highs.run() != HighsStatus::kOk) {
+        printf("Solve failed\n");
+        return 1;
+      }
+      time += std::chrono::duration<double>(clock::now() - start).count();
+      iteration_count += highs.getInfo().simplex_iteration_count;
+    }
+    const double rate = iteration_count / time;
+    if (prefetch_distance == 0) {
+      base_rate = rate;
+      base_iteration_count = iteration_count;
+    }
+    printf(
+        "Prefetch distance %3d: %8d iterations in %8.3f s; %10.1f "
+        "iterations/s (speedup %5.2f)%s\n",
+        (int)prefetch_distance, (int)iteration_count, time, rate,
+        rate / base_rate,
+        iteration_count == base_iteration_count ? "" : " ITERATIONS DIFFER");
+  }
+  return 0;
+}
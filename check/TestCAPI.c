@@ -889,6 +889,127 @@ void test_passHessian() {
   Highs_destroy(highs);
 }
 
+void userInterruptCallback(const int callback_type, const char* message,
+                           const HighsCallbackDataOut* data_out,
+                           HighsCallbackDataIn* data_in,
+                           void* user_callback_data) {
+  HighsInt* num_call = (HighsInt*)user_callback_data;
+  (*num_call)++;
+  if (dev_run)
+    printf("userInterruptCallback(%d, \"%s\"): simplex iteration %d\n",
+           callback_type, message, (int)data_out->simplex_iteration_count);
+  assert(callback_type == kHighsCallbackSimplexIteration);
+  data_in->user_interrupt = 1;
+}
+
+void test_callback() {
+  // Max   f  = x_0 + x_1
+  // s.t.        x_0 + 2x_1 <= 4
+  //            3x_0 +  x_1 <= 6
+  //             x_0 >= 0; x_1 >= 0
+  const HighsInt num_col = 2;
+  const HighsInt num_row = 2;
+  const HighsInt num_nz = 4;
+  double col_cost[2] = {1.0, 1.0};
+  double col_lower[2] = {0.0, 0.0};
+  double col_upper[2] = {1.0e30, 1.0e30};
+  double row_lower[2] = {-1.0e30, -1.0e30};
+  double row_upper[2] = {4.0, 6.0};
+  HighsInt a_start[2] = {0, 2};
+  HighsInt a_index[4] = {0, 1, 0, 1};
+  double a_value[4] = {1.0, 3.0, 2.0, 1.0};
+
+  void* highs = Highs_create();
+  Highs_setBoolOptionValue(highs, "output_flag", dev_run);
+  Highs_setStringOptionValue(highs, "presolve", "off");
+  HighsInt return_status =
+      Highs_passLp(highs, num_col, num_row, num_nz, kHighsMatrixFormatColwise,
+                   kHighsObjSenseMaximize, 0.0, col_cost, col_lower, col_upper,
+                   row_lower, row_upper, a_start, a_index, a_value);
+  assert(return_status == kHighsStatusOk);
+
+  HighsInt num_call = 0;
+  return_status = Highs_setCallback(highs, userInterruptCallback, &num_call);
+  assert(return_status == kHighsStatusOk);
+  return_status = Highs_startCallback(highs, kHighsCallbackSimplexIteration);
+  assert(return_status == kHighsStatusOk);
+  return_status = Highs_run(highs);
+  assert(return_status == kHighsStatusWarning);
+  assertIntValuesEqual("Number of callbacks", num_call, 1);
+  assertIntValuesEqual("Model status", Highs_getModelStatus(highs),
+                       kHighsModelStatusInterrupt);
+
+  return_status = Highs_stopCallback(highs, kHighsCallbackSimplexIteration);
+  assert(return_status == kHighsStatusOk);
+  Highs_clearSolver(highs);
+  return_status = Highs_run(highs);
+  assert(return_status == kHighsStatusOk);
+  assertIntValuesEqual("Number of callbacks", num_call, 1);
+  assertIntValuesEqual("Model status", Highs_getModelStatus(highs),
+                       kHighsModelStatusOptimal);
+  Highs_destroy(highs);
+}
+
+void test_solveLpBatch() {
+  // The LP of test_callback, maximizing each of x_0 + x_1, x_0 and x_1
+  const HighsInt num_lp = 3;
+  const HighsInt num_col[3] = {2, 2, 2};
+  const HighsInt num_row[3] = {2, 2, 2};
+  const HighsInt num_nz[3] = {4, 4, 4};
+  const HighsInt sense[3] = {kHighsObjSenseMaximize, kHighsObjSenseMaximize,
+                             kHighsObjSenseMaximize};
+  const double offset[3] = {0.0, 0.0, 0.0};
+  double col_cost0[2] = {1.0, 1.0};
+  double col_cost1[2] = {1.0, 0.0};
+  double col_cost2[2] = {0.0, 1.0};
+  double col_lower[2] = {0.0, 0.0};
+  double col_upper[2] = {1.0e30, 1.0e30};
+  double row_lower[2] = {-1.0e30, -1.0e30};
+  double row_upper[2] = {4.0, 6.0};
+  HighsInt a_start[2] = {0, 2};
+  HighsInt a_index[4] = {0, 1, 0, 1};
+  double a_value[4] = {1.0, 3.0, 2.0, 1.0};
+  const double* col_cost[3] = {col_cost0, col_cost1, col_cost2};
+  const double* col_lowers[3] = {col_lower, col_lower, col_lower};
+  const double* col_uppers[3] = {col_upper, col_upper, col_upper};
+  const double* row_lowers[3] = {row_lower, row_lower, row_lower};
+  const double* row_uppers[3] = {row_upper, row_upper, row_upper};
+  const HighsInt* a_starts[3] = {a_start, a_start, a_start};
+  const HighsInt* a_indices[3] = {a_index, a_index, a_index};
+  const double* a_values[3] = {a_value, a_value, a_value};
+
+  double col_value[3][2];
+  double* col_values[3] = {col_value[0], col_value[1], col_value[2]};
+  HighsInt model_status[3];
+  double objective_function_value[3];
+  const double optimal_objective_function_value[3] = {2.8, 2.0, 2.0};
+
+  void* highs = Highs_create();
+  Highs_setBoolOptionValue(highs, "output_flag", dev_run);
+  // Solve twice, so that the second batch reuses the workspaces
+  for (HighsInt pass = 0; pass < 2; pass++) {
+    HighsInt return_status = Highs_solveLpBatch(
+        highs, num_lp, num_col, num_row, num_nz, kHighsMatrixFormatColwise,
+        sense, offset, col_cost, col_lowers, col_uppers, row_lowers,
+        row_uppers, a_starts, a_indices, a_values, col_values, NULL, NULL,
+        NULL, NULL, NULL, model_status, objective_function_value);
+    assert(return_status == kHighsStatusOk);
+    for (HighsInt iX = 0; iX < num_lp; iX++) {
+      assertIntValuesEqual("Model status", model_status[iX],
+                           kHighsModelStatusOptimal);
+      assertDoubleValuesEqual("Objective", objective_function_value[iX],
+                              optimal_objective_function_value[iX]);
+      assertDoubleValuesEqual(
+          "Objective from solution",
+          col_cost[iX][0] * col_value[iX][0] + col_cost[iX][1] * col_value[iX][1],
+          optimal_objective_function_value[iX]);
+    }
+  }
+  // The incumbent model of the instance is unchanged
+  assertIntValuesEqual("Number of columns", Highs_getNumCol(highs), 0);
+  Highs_destroy(highs);
+}
+
 /*
 The horrible C in this causes problems in some of the CI tests,
 so suppress thius test until the C has been improved
@@ -945,6 +1066,8 @@ int main() {
   options();
   test_getColsByRange();
   test_passHessian();
+  test_callback();
+  test_solveLpBatch();
   //  test_setSolution();
   return 0;
 }
@@ -0,0 +1,195 @@
+#include <cstdio>
+
+#include "Highs.h"
+#include "catch.hpp"
+
+const bool dev_run = false;
+
+const HighsInt kSimplexInterruptIteration = 10;
+const HighsInt kIpmInterruptIteration = 3;
+
+// Data accumulated by the callbacks in these tests, passed as
+// user_callback_data
+struct CallbackTestData {
+  HighsInt num_call = 0;
+  HighsInt last_iteration_count = -1;
+  HighsInt num_improving_solution = 0;
+  HighsInt num_cut_round = 0;
+  double last_mip_primal_bound = kHighsInf;
+  double last_solution_objective = kHighsInf;
+  std::vector<double> last_solution;
+  bool interrupt_on_improving_solution = false;
+};
+
+static void userInterruptCallback(int callback_type, const std::string& message,
+                                  const HighsCallbackDataOut* data_out,
+                                  HighsCallbackDataIn* data_in,
+                                  void* user_callback_data) {
+  CallbackTestData& data = *static_cast<CallbackTestData*>(user_callback_data);
+  data.num_call++;
+  if (dev_run)
+    printf("userInterruptCallback(type %d, \"%s\")\n", callback_type,
+           message.c_str());
+  if (callback_type == kCallbackSimplexIteration) {
+    data.last_iteration_count = data_out->simplex_iteration_count;
+    data_in->user_interrupt =
+        data_out->simplex_iteration_count >= kSimplexInterruptIteration;
+  } else if (callback_type == kCallbackIpmIteration) {
+    data.last_iteration_count = data_out->ipm_iteration_count;
+    data_in->user_interrupt =
+        data_out->ipm_iteration_count >= kIpmInterruptIteration;
+  }
+}
+
+static void userMipCallback(int callback_type, const std::string& message,
+                            const HighsCallbackDataOut* data_out,
+                            HighsCallbackDataIn* data_in,
+                            void* user_callback_data) {
+  CallbackTestData& data = *static_cast<CallbackTestData*>(user_callback_data);
+  data.num_call++;
+  if (callback_type == kCallbackMipImprovingSolution) {
+    data.num_improving_solution++;
+    // Bounds are consistent with the gap
+    REQUIRE(data_out->mip_dual_bound <= data_out->mip_primal_bound + 1e-6);
+    REQUIRE(data_out->mip_gap >= 0);
+    // The primal bound can only improve
+    REQUIRE(data_out->mip_primal_bound <= data.last_mip_primal_bound);
+    data.last_mip_primal_bound = data_out->mip_primal_bound;
+    data.last_solution_objective = data_out->objective_function_value;
+    data.last_solution.assign(
+        data_out->mip_solution,
+        data_out->mip_solution + data_out->mip_solution_size);
+    if (dev_run)
+      printf("Improving solution %d: objective %g; gap %g\n",
+             (int)data.num_improving_solution,
+             data_out->objective_function_value, data_out->mip_gap);
+    data_in->user_interrupt = data.interrupt_on_improving_solution;
+  } else if (callback_type == kCallbackMipCutRound) {
+    data.num_cut_round++;
+    REQUIRE(data_out->mip_cut_round == data.num_cut_round);
+  } else if (callback_type == kCallbackMipNode) {
+    REQUIRE(data_out->mip_node_count >= 0);
+  }
+}
+
+TEST_CASE("callback-simplex-interrupt", "[highs_callback]") {
+  std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.setOptionValue("presolve", kHighsOffString);
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+
+  // Can't start a callback before it's set
+  REQUIRE(highs.startCallback(kCallbackSimplexIteration) ==
+          HighsStatus::kError);
+
+  CallbackTestData data;
+  REQUIRE(highs.setCallback(userInterruptCallback, &data) == HighsStatus::kOk);
+  REQUIRE(highs.startCallback(kCallbackSimplexIteration) == HighsStatus::kOk);
+  REQUIRE(highs.startCallback(kCallbackMax + 1) == HighsStatus::kError);
+
+  REQUIRE(highs.run() == HighsStatus::kWarning);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kInterrupt);
+  REQUIRE(data.last_iteration_count == kSimplexInterruptIteration);
+  REQUIRE(highs.getInfo().simplex_iteration_count ==
+          kSimplexInterruptIteration);
+
+  // Once stopped, the callback isn't called and the solve completes
+  REQUIRE(highs.stopCallback(kCallbackSimplexIteration) == HighsStatus::kOk);
+  const HighsInt num_call = data.num_call;
+  highs.clearSolver();
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(data.num_call == num_call);
+}
+
+TEST_CASE("callback-ipm-interrupt", "[highs_callback]") {
+  std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.setOptionValue("presolve", kHighsOffString);
+  highs.setOptionValue("solver", kIpmString);
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+
+  CallbackTestData data;
+  highs.setCallback(userInterruptCallback, &data);
+  highs.startCallback(kCallbackIpmIteration);
+  REQUIRE(highs.run() == HighsStatus::kWarning);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kInterrupt);
+  REQUIRE(data.num_call == kIpmInterruptIteration);
+  REQUIRE(data.last_iteration_count == kIpmInterruptIteration);
+}
+
+TEST_CASE("callback-presolve", "[highs_callback]") {
+  std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+
+  HighsInt presolved_num_col = -1;
+  HighsInt presolved_num_row = -1;
+  highs.setCallback(
+      [&](int callback_type, const std::string& message,
+          const HighsCallbackDataOut* data_out, HighsCallbackDataIn* data_in,
+          void* user_callback_data) {
+        REQUIRE(callback_type == kCallbackPresolveComplete);
+        presolved_num_col = data_out->presolved_num_col;
+        presolved_num_row = data_out->presolved_num_row;
+        data_in->user_interrupt = 1;
+      });
+  highs.startCallback(kCallbackPresolveComplete);
+  REQUIRE(highs.run() == HighsStatus::kWarning);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kInterrupt);
+  REQUIRE(presolved_num_col > 0);
+  REQUIRE(presolved_num_col <= highs.getNumCol());
+  REQUIRE(presolved_num_row > 0);
+  REQUIRE(presolved_num_row <= highs.getNumRow());
+}
+
+TEST_CASE("callback-mip-improving-solution", "[highs_callback]") {
+  std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/egout.mps";
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+
+  CallbackTestData data;
+  highs.setCallback(userMipCallback, &data);
+  highs.startCallback(kCallbackMipImprovingSolution);
+  highs.startCallback(kCallbackMipCutRound);
+  highs.startCallback(kCallbackMipNode);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(data.num_improving_solution > 0);
+  REQUIRE(data.num_cut_round > 0);
+  // The last improving solution is the optimal solution
+  const double objective_function_value =
+      highs.getInfo().objective_function_value;
+  REQUIRE(std::fabs(data.last_solution_objective - objective_function_value) <=
+          1e-6 * std::max(1.0, std::fabs(objective_function_value)));
+  REQUIRE(data.last_solution == highs.getSolution().col_value);
+}
+
+TEST_CASE("callback-mip-interrupt", "[highs_callback]") {
+  std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/flugpl.mps";
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+
+  CallbackTestData data;
+  data.interrupt_on_improving_solution = true;
+  highs.setCallback(userMipCallback, &data);
+  highs.startCallback(kCallbackMipImprovingSolution);
+  REQUIRE(highs.run() == HighsStatus::kWarning);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kInterrupt);
+  REQUIRE(data.num_improving_solution == 1);
+  // Solutions found before the solver stops may improve on the one
+  // passed to the callback
+  REQUIRE(highs.getSolution().value_valid);
+  REQUIRE(highs.getInfo().objective_function_value <=
+          data.last_solution_objective);
+}
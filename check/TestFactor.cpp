@@ -1,5 +1,6 @@
 #include "Highs.h"
 #include "catch.hpp"
+#include "parallel/HighsParallel.h"
 #include "util/HFactor.h"
 
 const bool dev_run = false;
@@ -178,6 +179,174 @@ TEST_CASE("Factor-get-set-invert", "[highs_test_factor]") {
     REQUIRE(iterate(variable_out[basis_change], variable_in[basis_change]));
 }
 
+TEST_CASE("Factor-level-solve", "[highs_test_factor]") {
+  // Compare dense FTRAN and BTRAN using level scheduling with the
+  // serial solves, after INVERT and after FT updates
+  highs::parallel::initialize_scheduler();
+  for (std::string model : {"25fv47", "80bau3b", "greenbea"}) {
+    std::string filename =
+        std::string(HIGHS_DIR) + "/check/instances/" + model + ".mps";
+    Highs highs;
+    highs.setOptionValue("output_flag", dev_run);
+    highs.readModel(filename);
+    highs.run();
+    const HighsLp& lp = highs.getLp();
+    const HighsInt num_col = lp.num_col_;
+    const HighsInt num_row = lp.num_row_;
+    std::vector<HighsInt> basic_index(num_row);
+    highs.getBasicVariables(&basic_index[0]);
+    for (HighsInt iRow = 0; iRow < num_row; iRow++)
+      if (basic_index[iRow] < 0)
+        basic_index[iRow] = num_col - basic_index[iRow] - 1;
+    std::vector<HighsInt> level_basic_index = basic_index;
+    HFactor serial_factor;
+    HFactor level_factor;
+    serial_factor.setup(lp.a_matrix_, basic_index);
+    level_factor.setup(lp.a_matrix_, level_basic_index);
+    level_factor.setParallelSolve(true);
+    REQUIRE(serial_factor.build() == 0);
+    REQUIRE(level_factor.build() == 0);
+    REQUIRE(basic_index == level_basic_index);
+
+    std::vector<bool> is_basic(num_col + num_row, false);
+    for (HighsInt iRow = 0; iRow < num_row; iRow++)
+      is_basic[basic_index[iRow]] = true;
+    HighsRandom random;
+    HVector serial_rhs;
+    HVector level_rhs;
+    serial_rhs.setup(num_row);
+    level_rhs.setup(num_row);
+    auto solveDifference = [&](const bool ftran) {
+      serial_rhs.clear();
+      for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+        serial_rhs.array[iRow] = random.fraction() - 0.5;
+        serial_rhs.index[serial_rhs.count++] = iRow;
+      }
+      level_rhs.copy(&serial_rhs);
+      if (ftran) {
+        serial_factor.ftranCall(serial_rhs, 1);
+        level_factor.ftranCall(level_rhs, 1);
+      } else {
+        serial_factor.btranCall(serial_rhs, 1);
+        level_factor.btranCall(level_rhs, 1);
+      }
+      double difference = 0;
+      for (HighsInt iRow = 0; iRow < num_row; iRow++)
+        difference = std::max(
+            std::fabs(serial_rhs.array[iRow] - level_rhs.array[iRow]) /
+                (1 + std::fabs(serial_rhs.array[iRow])),
+            difference);
+      return difference;
+    };
+    const HighsInt num_update = 20;
+    HVector col_aq;
+    HVector row_ep;
+    HVector level_col_aq;
+    HVector level_row_ep;
+    col_aq.setup(num_row);
+    row_ep.setup(num_row);
+    level_col_aq.setup(num_row);
+    level_row_ep.setup(num_row);
+    for (HighsInt update = 0; update <= num_update; update++) {
+      const double ftran_difference = solveDifference(true);
+      const double btran_difference = solveDifference(false);
+      if (dev_run)
+        printf("%s update %2d: FTRAN difference %g; BTRAN difference %g\n",
+               model.c_str(), (int)update, ftran_difference,
+               btran_difference);
+      REQUIRE(ftran_difference < 1e-8);
+      REQUIRE(btran_difference < 1e-8);
+      if (update == num_update) break;
+      // Exchange a random nonbasic variable with the basic variable
+      // in the row of the largest entry of its pivotal column
+      HighsInt variable_in;
+      do {
+        variable_in = random.integer(num_col + num_row);
+      } while (is_basic[variable_in]);
+      col_aq.clear();
+      col_aq.packFlag = true;
+      if (variable_in < num_col) {
+        lp.a_matrix_.collectAj(col_aq, variable_in, 1);
+      } else {
+        col_aq.array[variable_in - num_col] = 1;
+        col_aq.index[col_aq.count++] = variable_in - num_col;
+      }
+      level_col_aq.copy(&col_aq);
+      level_col_aq.packFlag = true;
+      serial_factor.ftranCall(col_aq, 1);
+      level_factor.ftranCall(level_col_aq, 1);
+      HighsInt row_out = 0;
+      for (HighsInt iRow = 0; iRow < num_row; iRow++)
+        if (std::fabs(col_aq.array[iRow]) > std::fabs(col_aq.array[row_out]))
+          row_out = iRow;
+      row_ep.clear();
+      row_ep.packFlag = true;
+      row_ep.array[row_out] = 1;
+      row_ep.index[row_ep.count++] = row_out;
+      level_row_ep.copy(&row_ep);
+      level_row_ep.packFlag = true;
+      serial_factor.btranCall(row_ep, 1);
+      level_factor.btranCall(level_row_ep, 1);
+      is_basic[basic_index[row_out]] = false;
+      is_basic[variable_in] = true;
+      basic_index[row_out] = variable_in;
+      level_basic_index[row_out] = variable_in;
+      HighsInt hint = 0;
+      HighsInt level_row_out = row_out;
+      serial_factor.update(&col_aq, &row_ep, &row_out, &hint);
+      level_factor.update(&level_col_aq, &level_row_ep, &level_row_out,
+                          &hint);
+    }
+  }
+}
+
+TEST_CASE("Factor-parallel-build", "[highs_test_factor]") {
+  // Check that eliminating the columns of long pivotal rows
+  // concurrently gives the same factors as eliminating serially. The
+  // basis matrices are random, with a nonzero diagonal, so that their
+  // kernels are large
+  highs::parallel::initialize_scheduler();
+  const HighsInt dim = 400;
+  HighsRandom random;
+  for (double density : {0.01, 0.05}) {
+    HighsSparseMatrix a_matrix;
+    a_matrix.num_col_ = dim;
+    a_matrix.num_row_ = dim;
+    for (HighsInt iCol = 0; iCol < dim; iCol++) {
+      for (HighsInt iRow = 0; iRow < dim; iRow++) {
+        if (iRow != iCol && random.fraction() >= density) continue;
+        a_matrix.index_.push_back(iRow);
+        a_matrix.value_.push_back(iRow == iCol ? 10 : random.fraction() - 0.5);
+      }
+      a_matrix.start_.push_back(a_matrix.index_.size());
+    }
+    std::vector<HighsInt> basic_index(dim);
+    for (HighsInt iCol = 0; iCol < dim; iCol++) basic_index[iCol] = iCol;
+    std::vector<HighsInt> parallel_basic_index = basic_index;
+    HFactor serial_factor;
+    HFactor parallel_factor;
+    serial_factor.setup(a_matrix, basic_index);
+    parallel_factor.setup(a_matrix, parallel_basic_index);
+    parallel_factor.setParallelBuild(true);
+    REQUIRE(serial_factor.build() == 0);
+    REQUIRE(parallel_factor.build() == 0);
+    REQUIRE(basic_index == parallel_basic_index);
+    REQUIRE(serial_factor.build_synthetic_tick ==
+            parallel_factor.build_synthetic_tick);
+    InvertibleRepresentation serial_invert = serial_factor.getInvert();
+    InvertibleRepresentation parallel_invert = parallel_factor.getInvert();
+    REQUIRE(serial_invert.l_pivot_index == parallel_invert.l_pivot_index);
+    REQUIRE(serial_invert.l_start == parallel_invert.l_start);
+    REQUIRE(serial_invert.l_index == parallel_invert.l_index);
+    REQUIRE(serial_invert.l_value == parallel_invert.l_value);
+    REQUIRE(serial_invert.u_pivot_index == parallel_invert.u_pivot_index);
+    REQUIRE(serial_invert.u_pivot_value == parallel_invert.u_pivot_value);
+    REQUIRE(serial_invert.u_start == parallel_invert.u_start);
+    REQUIRE(serial_invert.u_index == parallel_invert.u_index);
+    REQUIRE(serial_invert.u_value == parallel_invert.u_value);
+  }
+}
+
 HighsInt rowOut(const HighsInt variable_out) {
   for (HighsInt iRow = 0; iRow < num_row; iRow++)
     if (basic_set[iRow] == variable_out) return iRow;
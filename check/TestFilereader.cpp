@@ -8,6 +8,7 @@
 #include "io/HighsIO.h"
 #include "lp_data/HighsLp.h"
 #include "lp_data/HighsLpUtils.h"
+#include "parallel/HighsParallel.h"
 
 const bool dev_run = false;
 
@@ -113,6 +114,31 @@ TEST_CASE("filereader-free-format-parser", "[highs_filereader]") {
   REQUIRE(are_the_same);
 }
 
+TEST_CASE("filereader-free-format-parser-concurrent", "[highs_filereader]") {
+  // With the scheduler running, the free format parser reads the COLUMNS
+  // section of these files in several chunks concurrently
+  highs::parallel::initialize_scheduler();
+  std::vector<std::string> model_names = {"25fv47", "80bau3b", "greenbea",
+                                          "egout", "p0548"};
+  for (const std::string& model_name : model_names) {
+    std::string filename =
+        std::string(HIGHS_DIR) + "/check/instances/" + model_name + ".mps";
+
+    Highs highs;
+    if (!dev_run) highs.setOptionValue("output_flag", false);
+    REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+    HighsLp lp_free = highs.getLp();
+
+    REQUIRE(highs.setOptionValue("mps_parser_type_free", false) ==
+            HighsStatus::kOk);
+    REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+    HighsLp lp_fixed = highs.getLp();
+
+    bool are_the_same = lp_free == lp_fixed;
+    REQUIRE(are_the_same);
+  }
+}
+
 // No commas in test case name.
 TEST_CASE("filereader-read-mps-ems-lp", "[highs_filereader]") {
   std::string filename;
@@ -212,3 +238,34 @@ TEST_CASE("filereader-integrality-constraints", "[highs_filereader]") {
   bool are_the_same = lp_free == lp_fixed;
   REQUIRE(are_the_same);
 }
+
+TEST_CASE("filereader-hmodel", "[highs_filereader]") {
+  // Write each model as a binary snapshot and check that reading it
+  // gives the same model
+  std::vector<std::string> model_files = {"25fv47.mps", "egout.mps",
+                                          "qptestnw.lp"};
+  std::vector<std::string> extensions = {".hmodel"};
+#ifdef ZLIB_FOUND
+  extensions.push_back(".hmodel.gz");
+#endif
+  for (const std::string& model_file : model_files) {
+    std::string filename =
+        std::string(HIGHS_DIR) + "/check/instances/" + model_file;
+    Highs highs;
+    if (!dev_run) highs.setOptionValue("output_flag", false);
+    REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+    HighsModel model = highs.getModel();
+
+    for (const std::string& extension : extensions) {
+      std::string filename_hmodel = extractModelName(filename) + extension;
+      REQUIRE(highs.writeModel(filename_hmodel) == HighsStatus::kOk);
+      REQUIRE(highs.readModel(filename_hmodel) == HighsStatus::kOk);
+      HighsModel hmodel = highs.getModel();
+      bool are_the_same = model.lp_ == hmodel.lp_;
+      REQUIRE(are_the_same);
+      are_the_same = model.hessian_ == hmodel.hessian_;
+      REQUIRE(are_the_same);
+      std::remove(filename_hmodel.c_str());
+    }
+  }
+}
@@ -0,0 +1,75 @@
+#include <cmath>
+#include <vector>
+
+#include "Highs.h"
+#include "catch.hpp"
+#include "util/HighsPriceKernels.h"
+#include "util/HighsRandom.h"
+
+const bool dev_run = false;
+
+// No commas in test case name.
+TEST_CASE("HighsSparseMatrix-price-kernels", "[highs_sparse_matrix]") {
+  // Check that the vectorised PRICE kernels available on this CPU
+  // agree with the scalar kernels
+  std::vector<std::string> model_names = {"25fv47", "greenbea", "shell"};
+  for (const std::string& model_name : model_names) {
+    std::string filename =
+        std::string(HIGHS_DIR) + "/check/instances/" + model_name + ".mps";
+    Highs highs;
+    if (!dev_run) highs.setOptionValue("output_flag", false);
+    REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+    HighsSparseMatrix a_matrix = highs.getLp().a_matrix_;
+    a_matrix.ensureColwise();
+    HighsSparseMatrix ar_matrix;
+    ar_matrix.createRowwise(a_matrix);
+    const HighsInt num_col = a_matrix.num_col_;
+    const HighsInt num_row = a_matrix.num_row_;
+
+    HighsRandom random;
+    std::vector<double> x(num_row);
+    std::vector<HighsInt> row_index;
+    for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+      x[iRow] = random.fraction() - 0.5;
+      if (random.fraction() < 0.2) row_index.push_back(iRow);
+    }
+
+    std::vector<double> scalar_array(num_col);
+    std::vector<HighsInt> scalar_index(num_col);
+    HighsInt scalar_count = highsPriceByColumn(
+        HighsSimdLevel::kScalar, num_col, a_matrix.start_.data(),
+        a_matrix.index_.data(), a_matrix.value_.data(), x.data(),
+        scalar_array.data(), scalar_index.data());
+    std::vector<double> scalar_result(num_col);
+    highsPriceByRowDenseResult(
+        HighsSimdLevel::kScalar, row_index.size(), row_index.data(), x.data(),
+        ar_matrix.start_.data(), ar_matrix.start_.data() + 1,
+        ar_matrix.index_.data(), ar_matrix.value_.data(),
+        scalar_result.data());
+
+    for (HighsInt level = (HighsInt)HighsSimdLevel::kAvx2;
+         level <= (HighsInt)highsSimdLevel(); level++) {
+      std::vector<double> array(num_col);
+      std::vector<HighsInt> index(num_col);
+      HighsInt count = highsPriceByColumn(
+          (HighsSimdLevel)level, num_col, a_matrix.start_.data(),
+          a_matrix.index_.data(), a_matrix.value_.data(), x.data(),
+          array.data(), index.data());
+      // The dot products are summed in a different order
+      REQUIRE(count == scalar_count);
+      for (HighsInt k = 0; k < count; k++) {
+        HighsInt iCol = index[k];
+        REQUIRE(iCol == scalar_index[k]);
+        REQUIRE(std::fabs(array[iCol] - scalar_array[iCol]) <=
+                1e-12 * (1 + std::fabs(scalar_array[iCol])));
+      }
+      // The row updates are exact
+      std::vector<double> result(num_col);
+      highsPriceByRowDenseResult(
+          (HighsSimdLevel)level, row_index.size(), row_index.data(), x.data(),
+          ar_matrix.start_.data(), ar_matrix.start_.data() + 1,
+          ar_matrix.index_.data(), ar_matrix.value_.data(), result.data());
+      REQUIRE(result == scalar_result);
+    }
+  }
+}
@@ -122,3 +122,58 @@ TEST_CASE("HotStart-rgn", "[highs_test_hot_start]") {
   // Cannot use the continuous solution as a hot start now
   REQUIRE(highs.setHotStart(hot_start) == HighsStatus::kError);
 }
+
+TEST_CASE("HotStart-dual-edge-weights", "[highs_test_hot_start]") {
+  std::string filename;
+  filename = std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.setOptionValue("presolve", kHighsOffString);
+  highs.readModel(filename);
+  highs.run();
+  HotStart hot_start = highs.getHotStart();
+  REQUIRE(hot_start.valid);
+  // The dual steepest edge weights are part of the hot start
+  const HighsInt num_row = highs.getNumRow();
+  REQUIRE((HighsInt)hot_start.dual_edge_weight.size() == num_row);
+
+  // Perturb the costs, and solve the modified LP in a separate
+  // instance from the hot start - with and without the weights - and
+  // from scratch
+  HighsLp lp = highs.getLp();
+  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol += 7)
+    lp.col_cost_[iCol] *= 1.001;
+  HotStart hot_start_no_weights = hot_start;
+  hot_start_no_weights.dual_edge_weight.clear();
+  std::vector<double> objective_function_value;
+  std::vector<HighsInt> simplex_iteration_count;
+  for (HighsInt k = 0; k < 3; k++) {
+    Highs local_highs;
+    local_highs.setOptionValue("output_flag", dev_run);
+    REQUIRE(local_highs.passModel(lp) == HighsStatus::kOk);
+    if (k == 0) REQUIRE(local_highs.setHotStart(hot_start) == HighsStatus::kOk);
+    if (k == 1)
+      REQUIRE(local_highs.setHotStart(hot_start_no_weights) ==
+              HighsStatus::kOk);
+    REQUIRE(local_highs.run() == HighsStatus::kOk);
+    REQUIRE(local_highs.getModelStatus() == HighsModelStatus::kOptimal);
+    objective_function_value.push_back(
+        local_highs.getInfo().objective_function_value);
+    simplex_iteration_count.push_back(
+        local_highs.getInfo().simplex_iteration_count);
+    if (dev_run)
+      printf("Solve %d: %d iterations; objective %g\n", (int)k,
+             (int)simplex_iteration_count[k], objective_function_value[k]);
+  }
+  for (HighsInt k = 1; k < 3; k++)
+    REQUIRE(std::fabs(objective_function_value[k] -
+                      objective_function_value[0]) <=
+            double_equal_tolerance *
+                std::max(1.0, std::fabs(objective_function_value[0])));
+  REQUIRE(simplex_iteration_count[0] < simplex_iteration_count[2]);
+
+  // Weights must be consistent with the number of rows
+  hot_start.dual_edge_weight.push_back(1.0);
+  REQUIRE(highs.setHotStart(hot_start) == HighsStatus::kError);
+}
@@ -82,3 +82,40 @@ TEST_CASE("test-ipx", "[highs_ipx]") {
 
   (void)(info);  // surpress unused variable.
 }
+
+TEST_CASE("test-ipx-parallel", "[highs_ipx]") {
+  // Solving with parallel matrix-vector products and preconditioner
+  // should give the same iterates as solving in serial
+  highs::parallel::initialize_scheduler();
+  double x[2][num_var], xl[2][num_var], xu[2][num_var], slack[2][num_constr];
+  double y[2][num_constr], zl[2][num_var], zu[2][num_var];
+  ipx::Info info[2];
+  for (Int parallel = 0; parallel < 2; parallel++) {
+    ipx::LpSolver lps;
+    ipx::Parameters parameters;
+    if (!dev_run) parameters.display = 0;
+    parameters.crossover = 0;
+    parameters.parallel = parallel;
+    lps.SetParameters(parameters);
+
+    Int load_status = lps.LoadModel(num_var, obj, lb, ub, num_constr, Ap, Ai,
+                                    Ax, rhs, constr_type);
+    REQUIRE(load_status == 0);
+
+    Int status = lps.Solve();
+    REQUIRE(status == IPX_STATUS_solved);
+    info[parallel] = lps.GetInfo();
+    lps.GetInteriorSolution(x[parallel], xl[parallel], xu[parallel],
+                            slack[parallel], y[parallel], zl[parallel],
+                            zu[parallel]);
+  }
+  REQUIRE(info[0].iter == info[1].iter);
+  REQUIRE(info[0].kktiter1 == info[1].kktiter1);
+  REQUIRE(info[0].kktiter2 == info[1].kktiter2);
+  for (HighsInt j = 0; j < num_var; j++) {
+    REQUIRE(x[0][j] == x[1][j]);
+    REQUIRE(zl[0][j] == zl[1][j]);
+    REQUIRE(zu[0][j] == zu[1][j]);
+  }
+  for (HighsInt i = 0; i < num_constr; i++) REQUIRE(y[0][i] == y[1][i]);
+}
@@ -423,3 +423,244 @@ TEST_CASE("dual-objective-upper-bound", "[highs_lp_solver]") {
   if (dev_run) printf("\nOptimal objective value error = %g\n", error);
   REQUIRE(error < 1e-10);
 }
+
+TEST_CASE("LP-concurrent", "[highs_lp_solver]") {
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  const HighsInfo& info = highs.getInfo();
+  std::vector<std::string> models = {"adlittle", "e226", "etamacro"};
+  for (std::string model : models) {
+    const std::string model_file =
+        std::string(HIGHS_DIR) + "/check/instances/" + model + ".mps";
+    REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+    REQUIRE(highs.setOptionValue("solver", kSimplexString) ==
+            HighsStatus::kOk);
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    const double simplex_objective = info.objective_function_value;
+
+    // Race the solvers from scratch, with and without presolve
+    for (HighsInt k = 0; k < 2; k++) {
+      REQUIRE(highs.setOptionValue("presolve",
+                                   k ? kHighsOffString : kHighsChooseString) ==
+              HighsStatus::kOk);
+      REQUIRE(highs.setOptionValue("solver", kConcurrentString) ==
+              HighsStatus::kOk);
+      highs.clearSolver();
+      REQUIRE(highs.run() == HighsStatus::kOk);
+      REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+      REQUIRE(highs.getBasis().valid);
+      const double error = fabs(info.objective_function_value -
+                                simplex_objective) /
+                           std::max(1.0, fabs(simplex_objective));
+      if (dev_run)
+        printf("Concurrent solve of %s: objective error = %g\n",
+               model.c_str(), error);
+      REQUIRE(error < 1e-8);
+    }
+    REQUIRE(highs.setOptionValue("presolve", kHighsChooseString) ==
+            HighsStatus::kOk);
+  }
+}
+
+TEST_CASE("LP-work-limit", "[highs_lp_solver]") {
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  const HighsInfo& info = highs.getInfo();
+  const std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+  highs.setOptionValue("presolve", kHighsOffString);
+  std::vector<std::string> solvers = {kSimplexString, kIpmString};
+  for (std::string solver : solvers) {
+    highs.setOptionValue("solver", solver);
+    highs.setOptionValue("work_limit", kHighsInf);
+    highs.clearSolver();
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    const double work_units = info.work_units;
+    REQUIRE(work_units > 0);
+    // The solver stops at the same point each time the work limit is
+    // reached
+    highs.setOptionValue("work_limit", 0.5 * work_units);
+    highs.clearSolver();
+    REQUIRE(highs.run() == HighsStatus::kWarning);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kTimeLimit);
+    const HighsInt simplex_iteration_count = info.simplex_iteration_count;
+    const HighsInt ipm_iteration_count = info.ipm_iteration_count;
+    const double limited_work_units = info.work_units;
+    if (dev_run)
+      printf("Solver %s: work units %g; limited to %g after %d+%d iterations\n",
+             solver.c_str(), work_units, limited_work_units,
+             (int)simplex_iteration_count, (int)ipm_iteration_count);
+    highs.clearSolver();
+    REQUIRE(highs.run() == HighsStatus::kWarning);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kTimeLimit);
+    REQUIRE(info.simplex_iteration_count == simplex_iteration_count);
+    REQUIRE(info.ipm_iteration_count == ipm_iteration_count);
+    REQUIRE(info.work_units == limited_work_units);
+  }
+}
+
+TEST_CASE("LP-batch", "[highs_lp_solver]") {
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  const std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+  const HighsLp& incumbent_lp = highs.getLp();
+  // Solve perturbations of the incumbent LP
+  const HighsInt num_lp = 16;
+  std::vector<HighsLp> lps(num_lp, incumbent_lp);
+  for (HighsInt iX = 0; iX < num_lp; iX++) {
+    HighsLp& lp = lps[iX];
+    for (HighsInt iCol = iX % 2; iCol < lp.num_col_; iCol += 2)
+      lp.col_cost_[iCol] *= 1 + 0.01 * iX;
+  }
+  std::vector<HighsBatchResult> results;
+  REQUIRE(highs.solveBatch(lps, results) == HighsStatus::kOk);
+  REQUIRE(HighsInt(results.size()) == num_lp);
+  // The incumbent model is unchanged
+  REQUIRE(highs.getNumCol() == lps[0].num_col_);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kNotset);
+
+  Highs single;
+  single.setOptionValue("output_flag", false);
+  for (HighsInt iX = 0; iX < num_lp; iX++) {
+    const HighsBatchResult& result = results[iX];
+    REQUIRE(result.run_status == HighsStatus::kOk);
+    REQUIRE(result.model_status == HighsModelStatus::kOptimal);
+    REQUIRE(result.solution.value_valid);
+    REQUIRE(result.basis.valid);
+    REQUIRE(HighsInt(result.solution.col_value.size()) == lps[iX].num_col_);
+    single.passModel(lps[iX]);
+    REQUIRE(single.run() == HighsStatus::kOk);
+    const double objective_function_value =
+        single.getInfo().objective_function_value;
+    if (dev_run)
+      printf("LP %2d: objective %g; batch objective %g\n", (int)iX,
+             objective_function_value, result.objective_function_value);
+    REQUIRE(std::fabs(result.objective_function_value -
+                      objective_function_value) <=
+            1e-8 * std::max(1.0, std::fabs(objective_function_value)));
+  }
+  // A second batch reuses the workspaces and gives the same results
+  std::vector<HighsBatchResult> repeat_results;
+  REQUIRE(highs.solveBatch(lps, repeat_results) == HighsStatus::kOk);
+  for (HighsInt iX = 0; iX < num_lp; iX++)
+    REQUIRE(repeat_results[iX].objective_function_value ==
+            results[iX].objective_function_value);
+}
+
+TEST_CASE("LP-dual-tasks", "[highs_lp_solver]") {
+  // The sliced CHUZC of the dual tasks strategy gives the optimal
+  // objective, and is deterministic
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  const HighsInfo& info = highs.getInfo();
+  const std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/25fv47.mps";
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+  highs.setOptionValue("presolve", kHighsOffString);
+  highs.run();
+  const double objective_function_value = info.objective_function_value;
+
+  highs.setOptionValue("simplex_strategy", kSimplexStrategyDualTasks);
+  highs.setOptionValue("simplex_min_concurrency", 4);
+  highs.setOptionValue("simplex_max_concurrency", 4);
+  HighsInt simplex_iteration_count = -1;
+  for (HighsInt k = 0; k < 2; k++) {
+    highs.clearSolver();
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    REQUIRE(std::fabs(info.objective_function_value -
+                      objective_function_value) <=
+            1e-8 * std::max(1.0, std::fabs(objective_function_value)));
+    if (k) REQUIRE(info.simplex_iteration_count == simplex_iteration_count);
+    simplex_iteration_count = info.simplex_iteration_count;
+  }
+}
+
+TEST_CASE("LP-dual-overlap", "[highs_lp_solver]") {
+  // Overlapping the FTRANs and updates of serial dual simplex
+  // iterations doesn't change the iterations
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  const HighsInfo& info = highs.getInfo();
+  const std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/25fv47.mps";
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+  highs.setOptionValue("presolve", kHighsOffString);
+  highs.setOptionValue("threads", 2);
+  highs.setOptionValue("parallel", kHighsOffString);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  const HighsInt simplex_iteration_count = info.simplex_iteration_count;
+  const double objective_function_value = info.objective_function_value;
+
+  highs.setOptionValue("parallel", kHighsChooseString);
+  highs.clearSolver();
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(info.simplex_iteration_count == simplex_iteration_count);
+  REQUIRE(info.objective_function_value == objective_function_value);
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("LP-primal-parallel", "[highs_lp_solver]") {
+  // Sliced PRICE and partitioned CHUZC in primal simplex give the
+  // same optimal objective
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  const HighsInfo& info = highs.getInfo();
+  const std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+  highs.setOptionValue("presolve", kHighsOffString);
+  highs.setOptionValue("simplex_strategy", kSimplexStrategyPrimal);
+  highs.setOptionValue("threads", 2);
+  highs.setOptionValue("parallel", kHighsOffString);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  const double objective_function_value = info.objective_function_value;
+
+  highs.setOptionValue("parallel", kHighsOnString);
+  highs.clearSolver();
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(info.objective_function_value -
+                    objective_function_value) <=
+          1e-8 * std::max(1.0, std::fabs(objective_function_value)));
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("LP-ipm-cholesky", "[highs_lp_solver]") {
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  const HighsInfo& info = highs.getInfo();
+  std::vector<std::string> models = {"adlittle", "25fv47", "shell"};
+  for (std::string model : models) {
+    const std::string model_file =
+        std::string(HIGHS_DIR) + "/check/instances/" + model + ".mps";
+    REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+    REQUIRE(highs.setOptionValue("solver", kIpmString) == HighsStatus::kOk);
+    double objective[2];
+    for (HighsInt kkt_solver = kIpmKktSolverMin;
+         kkt_solver <= kIpmKktSolverMax; kkt_solver++) {
+      REQUIRE(highs.setOptionValue("ipm_kkt_solver", kkt_solver) ==
+              HighsStatus::kOk);
+      highs.clearSolver();
+      REQUIRE(highs.run() == HighsStatus::kOk);
+      REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+      REQUIRE(highs.getBasis().valid);
+      objective[kkt_solver] = info.objective_function_value;
+    }
+    const double error = fabs(objective[kIpmKktSolverCholesky] -
+                              objective[kIpmKktSolverIterative]) /
+                         std::max(1.0, fabs(objective[kIpmKktSolverIterative]));
+    if (dev_run)
+      printf("Cholesky IPM solve of %s: objective error = %g\n",
+             model.c_str(), error);
+    REQUIRE(error < 1e-8);
+  }
+}
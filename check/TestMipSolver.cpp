@@ -404,6 +404,198 @@ TEST_CASE("MIP-od", "[highs_test_mip_solver]") {
           double_equal_tolerance);
 }
 
+TEST_CASE("MIP-parallel-tree-search", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/flugpl.mps";
+  const double require_optimal_objective = 1201500;
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.readModel(filename);
+  const HighsInfo& info = highs.getInfo();
+  for (HighsInt mode = kMipParallelTreeSearchDeterministic;
+       mode <= kMipParallelTreeSearchOpportunistic; mode++) {
+    highs.setOptionValue("mip_parallel_tree_search", mode);
+    highs.clearSolver();
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    REQUIRE(fabs(info.objective_function_value - require_optimal_objective) <
+            1e-4);
+  }
+}
+
+TEST_CASE("MIP-parallel-strong-branching", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/flugpl.mps";
+  const double require_optimal_objective = 1201500;
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.readModel(filename);
+  const HighsInfo& info = highs.getInfo();
+  highs.setOptionValue("mip_parallel_strong_branching", true);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(fabs(info.objective_function_value - require_optimal_objective) <
+          1e-4);
+  // Results are merged in candidate order, so repeated solves are identical
+  const int64_t mip_node_count = info.mip_node_count;
+  const double mip_dual_bound = info.mip_dual_bound;
+  highs.clearSolver();
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(info.mip_node_count == mip_node_count);
+  REQUIRE(info.mip_dual_bound == mip_dual_bound);
+}
+
+TEST_CASE("MIP-parallel-separation", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/egout.mps";
+  const double require_optimal_objective = 568.1007;
+  // Separators only run concurrently when the scheduler has more than one
+  // worker
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.setOptionValue("threads", 2);
+  highs.readModel(filename);
+  const HighsInfo& info = highs.getInfo();
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(fabs(info.objective_function_value - require_optimal_objective) <
+          1e-4);
+  // Cuts are merged in the order of the separators, so repeated solves are
+  // identical
+  const int64_t mip_node_count = info.mip_node_count;
+  const double mip_dual_bound = info.mip_dual_bound;
+  highs.clearSolver();
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(info.mip_node_count == mip_node_count);
+  REQUIRE(info.mip_dual_bound == mip_dual_bound);
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("MIP-concurrent-root-heuristics", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  const double require_optimal_objective = 8966406.49152;
+  // The sub-MIPs run on the workers of the scheduler other than the main one
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.setOptionValue("threads", 3);
+  highs.setOptionValue("mip_concurrent_root_heuristics", true);
+  highs.readModel(filename);
+  const HighsInfo& info = highs.getInfo();
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(fabs(info.objective_function_value - require_optimal_objective) <
+          1e-6 * require_optimal_objective);
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("MIP-root-racing", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/flugpl.mps";
+  const double require_optimal_objective = 1201500;
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.setOptionValue("threads", 3);
+  highs.setOptionValue("mip_root_racers", 3);
+  highs.readModel(filename);
+  const HighsInfo& info = highs.getInfo();
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(fabs(info.objective_function_value - require_optimal_objective) <
+          1e-6 * require_optimal_objective);
+  // The results of the racers are merged in a fixed order
+  const int64_t mip_node_count = info.mip_node_count;
+  highs.clearSolver();
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(info.mip_node_count == mip_node_count);
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("MIP-node-queue-memory-limit", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  const double require_optimal_objective = 8966406.49152;
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  // Without memory for the open nodes, all of them are compressed and
+  // spilled, so the search reads each node back from the spill file
+  highs.setOptionValue("mip_node_queue_memory_limit", 0.0);
+  highs.readModel(filename);
+  const HighsInfo& info = highs.getInfo();
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(fabs(info.objective_function_value - require_optimal_objective) <
+          1e-6 * require_optimal_objective);
+  REQUIRE(info.mip_node_count > 1);
+}
+
+TEST_CASE("MIP-work-limit", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/egout.mps";
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.readModel(filename);
+  const HighsInfo& info = highs.getInfo();
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const double work_units = info.work_units;
+  REQUIRE(work_units > 0);
+  // Stopping at a work limit is reproducible, unlike a time limit
+  highs.setOptionValue("work_limit", 0.5 * work_units);
+  highs.clearSolver();
+  REQUIRE(highs.run() == HighsStatus::kWarning);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kTimeLimit);
+  const int64_t mip_node_count = info.mip_node_count;
+  const double mip_dual_bound = info.mip_dual_bound;
+  const double limited_work_units = info.work_units;
+  REQUIRE(limited_work_units >= 0.5 * work_units);
+  highs.clearSolver();
+  REQUIRE(highs.run() == HighsStatus::kWarning);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kTimeLimit);
+  REQUIRE(info.mip_node_count == mip_node_count);
+  REQUIRE(info.mip_dual_bound == mip_dual_bound);
+  REQUIRE(info.work_units == limited_work_units);
+}
+
+TEST_CASE("MIP-incremental", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/flugpl.mps";
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.setOptionValue("mip_incremental", true);
+  highs.readModel(filename);
+  const HighsInfo& info = highs.getInfo();
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+
+  // Change a cost, and cut off the incumbent by tightening the upper
+  // bound on its largest integer value
+  const HighsLp& lp = highs.getLp();
+  const std::vector<double>& col_value = highs.getSolution().col_value;
+  HighsInt max_col = -1;
+  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
+    if (lp.integrality_[iCol] != HighsVarType::kInteger) continue;
+    if (max_col < 0 || col_value[iCol] > col_value[max_col]) max_col = iCol;
+  }
+  REQUIRE(max_col >= 0);
+  const double upper = std::floor(col_value[max_col] + 0.5) - 1;
+  REQUIRE(upper >= lp.col_lower_[max_col]);
+  REQUIRE(highs.changeColBounds(max_col, lp.col_lower_[max_col], upper) ==
+          HighsStatus::kOk);
+  REQUIRE(highs.changeColCost(0, 1.1 * lp.col_cost_[0]) == HighsStatus::kOk);
+
+  // The hot started solve finds the same optimum as a solve from scratch
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  Highs scratch;
+  if (!dev_run) scratch.setOptionValue("output_flag", false);
+  scratch.passModel(highs.getModel());
+  REQUIRE(scratch.run() == HighsStatus::kOk);
+  REQUIRE(scratch.getModelStatus() == HighsModelStatus::kOptimal);
+  const double optimal_objective =
+      scratch.getInfo().objective_function_value;
+  REQUIRE(fabs(info.objective_function_value - optimal_objective) <
+          1e-6 * std::max(1.0, fabs(optimal_objective)));
+  if (dev_run)
+    printf("Hot started solve: %d nodes; solve from scratch: %d nodes\n",
+           (int)info.mip_node_count, (int)scratch.getInfo().mip_node_count);
+}
+
 bool objectiveOk(const double optimal_objective,
                  const double require_optimal_objective,
                  const bool dev_run = false) {
@@ -86,3 +86,31 @@ TEST_CASE("Presolve", "[highs_test_presolve]") {
   REQUIRE(highs.getModelStatus() == HighsModelStatus::kInfeasible);
   REQUIRE(presolved_model.isEmpty());
 }
+
+TEST_CASE("PresolveParallel", "[highs_test_presolve]") {
+  // Computing the candidates of the expensive presolve passes concurrently
+  // must give the same reductions as in serial
+  std::vector<std::string> models = {"25fv47", "greenbea", "shell", "dcmulti",
+                                     "egout", "p0548"};
+  for (std::string model : models) {
+    const std::string model_file =
+        std::string(HIGHS_DIR) + "/check/instances/" + model + ".mps";
+    HighsLp presolved_lp[2];
+    double objective[2];
+    for (HighsInt k = 0; k < 2; k++) {
+      Highs highs;
+      if (!dev_run) highs.setOptionValue("output_flag", false);
+      highs.setOptionValue("parallel", k ? kHighsOnString : kHighsOffString);
+      REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+      REQUIRE(highs.presolve() == HighsStatus::kOk);
+      REQUIRE(highs.getModelPresolveStatus() == HighsPresolveStatus::kReduced);
+      presolved_lp[k] = highs.getPresolvedLp();
+      REQUIRE(highs.run() == HighsStatus::kOk);
+      REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+      objective[k] = highs.getInfo().objective_function_value;
+    }
+    REQUIRE(presolved_lp[0].equalButForNames(presolved_lp[1]));
+    REQUIRE(std::fabs(objective[0] - objective[1]) <=
+            1e-6 * std::max(1.0, std::fabs(objective[0])));
+  }
+}
@@ -16,8 +16,10 @@
 #ifndef HIGHS_H_
 #define HIGHS_H_
 
+#include <memory>
 #include <sstream>
 
+#include "lp_data/HighsCallback.h"
 #include "lp_data/HighsLpUtils.h"
 #include "lp_data/HighsRanging.h"
 #include "lp_data/HighsSolutionDebug.h"
@@ -25,6 +27,21 @@
 #include "presolve/ICrash.h"
 #include "presolve/PresolveComponent.h"
 
+struct HighsMipHotStart;
+struct HighsBatchPool;
+
+/**
+ * @brief Outcome of solving one model in a call to Highs::solveBatch
+ */
+struct HighsBatchResult {
+  HighsStatus run_status = HighsStatus::kError;
+  HighsModelStatus model_status = HighsModelStatus::kNotset;
+  double objective_function_value = 0;
+  HighsInt simplex_iteration_count = 0;
+  HighsSolution solution;
+  HighsBasis basis;
+};
+
 /**
  * @brief Class to set parameters and run HiGHS
  */
@@ -132,6 +149,16 @@ class Highs {
    */
   HighsStatus run();
 
+  /**
+   * @brief Solve a batch of models concurrently using the task
+   * scheduler, according to the current options but with no
+   * logging. Rather than creating a Highs instance per model, each
+   * task draws on a pool of solver workspaces that is retained for
+   * later calls. The incumbent model is unchanged
+   */
+  HighsStatus solveBatch(const std::vector<HighsLp>& lps,
+                         std::vector<HighsBatchResult>& results);
+
   /**
    * @brief Postsolve the incumbent model
    */
@@ -840,6 +867,24 @@ class Highs {
                                                   void*),
                              void* log_callback_data = nullptr);
 
+  /**
+   * @brief Set the user callback invoked by the solvers at progress
+   * events, and the user data passed back to it. Callback types must
+   * be started individually with startCallback
+   */
+  HighsStatus setCallback(HighsCallbackFunctionType user_callback,
+                          void* user_callback_data = nullptr);
+
+  /**
+   * @brief Start the callback of the given type
+   */
+  HighsStatus startCallback(const int callback_type);
+
+  /**
+   * @brief Stop the callback of the given type
+   */
+  HighsStatus stopCallback(const int callback_type);
+
   /**
    * @brief Use the HighsBasis passed to set the internal HighsBasis
    * instance. The origin string is used to identify the source of the
@@ -1060,6 +1105,11 @@ class Highs {
   HighsOptions options_;
   HighsInfo info_;
   HighsRanging ranging_;
+  HighsCallback callback_;
+  // Data retained from the last MIP solve when mip_incremental is set
+  std::shared_ptr<HighsMipHotStart> mip_hot_start_;
+  // Solver workspaces reused by solveBatch
+  std::shared_ptr<HighsBatchPool> batch_pool_;
 
   HighsPresolveStatus model_presolve_status_ =
       HighsPresolveStatus::kNotPresolved;
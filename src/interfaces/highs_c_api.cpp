@@ -176,6 +176,77 @@ void Highs_destroy(void* highs) { delete (Highs*)highs; }
 
 HighsInt Highs_run(void* highs) { return (HighsInt)((Highs*)highs)->run(); }
 
+HighsInt Highs_solveLpBatch(
+    void* highs, const HighsInt num_lp, const HighsInt* num_col,
+    const HighsInt* num_row, const HighsInt* num_nz, const HighsInt a_format,
+    const HighsInt* sense, const double* offset, const double* const* col_cost,
+    const double* const* col_lower, const double* const* col_upper,
+    const double* const* row_lower, const double* const* row_upper,
+    const HighsInt* const* a_start, const HighsInt* const* a_index,
+    const double* const* a_value, double* const* col_value,
+    double* const* col_dual, double* const* row_value, double* const* row_dual,
+    HighsInt* const* col_basis_status, HighsInt* const* row_basis_status,
+    HighsInt* model_status, double* objective_function_value) {
+  const bool a_rowwise = a_format == (HighsInt)MatrixFormat::kRowwise;
+  std::vector<HighsLp> lps(num_lp);
+  for (HighsInt iX = 0; iX < num_lp; iX++) {
+    HighsLp& lp = lps[iX];
+    const HighsInt lp_num_col = num_col[iX];
+    const HighsInt lp_num_row = num_row[iX];
+    const HighsInt lp_num_nz = num_nz[iX];
+    lp.num_col_ = lp_num_col;
+    lp.num_row_ = lp_num_row;
+    lp.sense_ = sense[iX] == (HighsInt)ObjSense::kMaximize
+                    ? ObjSense::kMaximize
+                    : ObjSense::kMinimize;
+    lp.offset_ = offset[iX];
+    lp.col_cost_.assign(col_cost[iX], col_cost[iX] + lp_num_col);
+    lp.col_lower_.assign(col_lower[iX], col_lower[iX] + lp_num_col);
+    lp.col_upper_.assign(col_upper[iX], col_upper[iX] + lp_num_col);
+    lp.row_lower_.assign(row_lower[iX], row_lower[iX] + lp_num_row);
+    lp.row_upper_.assign(row_upper[iX], row_upper[iX] + lp_num_row);
+    const HighsInt num_vec = a_rowwise ? lp_num_row : lp_num_col;
+    lp.a_matrix_.format_ =
+        a_rowwise ? MatrixFormat::kRowwise : MatrixFormat::kColwise;
+    if (lp_num_nz > 0) {
+      lp.a_matrix_.start_.assign(a_start[iX], a_start[iX] + num_vec);
+      lp.a_matrix_.index_.assign(a_index[iX], a_index[iX] + lp_num_nz);
+      lp.a_matrix_.value_.assign(a_value[iX], a_value[iX] + lp_num_nz);
+    }
+    lp.a_matrix_.start_.resize(num_vec + 1);
+    lp.a_matrix_.start_[num_vec] = lp_num_nz;
+  }
+
+  std::vector<HighsBatchResult> results;
+  HighsStatus status = ((Highs*)highs)->solveBatch(lps, results);
+
+  for (HighsInt iX = 0; iX < num_lp; iX++) {
+    const HighsBatchResult& result = results[iX];
+    model_status[iX] = (HighsInt)result.model_status;
+    if (objective_function_value != nullptr)
+      objective_function_value[iX] = result.objective_function_value;
+    const HighsSolution& solution = result.solution;
+    const HighsBasis& basis = result.basis;
+    auto copyValues = [&](double* const* to, const std::vector<double>& from,
+                          const bool valid) {
+      if (to == nullptr || to[iX] == nullptr || !valid) return;
+      std::copy(from.begin(), from.end(), to[iX]);
+    };
+    auto copyStatus = [&](HighsInt* const* to,
+                          const std::vector<HighsBasisStatus>& from) {
+      if (to == nullptr || to[iX] == nullptr || !basis.valid) return;
+      for (size_t i = 0; i < from.size(); i++) to[iX][i] = (HighsInt)from[i];
+    };
+    copyValues(col_value, solution.col_value, solution.value_valid);
+    copyValues(row_value, solution.row_value, solution.value_valid);
+    copyValues(col_dual, solution.col_dual, solution.dual_valid);
+    copyValues(row_dual, solution.row_dual, solution.dual_valid);
+    copyStatus(col_basis_status, basis.col_status);
+    copyStatus(row_basis_status, basis.row_status);
+  }
+  return (HighsInt)status;
+}
+
 HighsInt Highs_readModel(void* highs, const char* filename) {
   return (HighsInt)((Highs*)highs)->readModel(std::string(filename));
 }
@@ -544,6 +615,28 @@ HighsInt Highs_setSolution(void* highs, const double* col_value,
   return (HighsInt)((Highs*)highs)->setSolution(solution);
 }
 
+HighsInt Highs_setCallback(void* highs, HighsCCallbackType user_callback,
+                           void* user_callback_data) {
+  HighsCallbackFunctionType callback = nullptr;
+  if (user_callback)
+    callback = [user_callback](int callback_type, const std::string& message,
+                               const HighsCallbackDataOut* data_out,
+                               HighsCallbackDataIn* data_in,
+                               void* callback_data) {
+      user_callback(callback_type, message.c_str(), data_out, data_in,
+                    callback_data);
+    };
+  return (HighsInt)((Highs*)highs)->setCallback(callback, user_callback_data);
+}
+
+HighsInt Highs_startCallback(void* highs, const int callback_type) {
+  return (HighsInt)((Highs*)highs)->startCallback(callback_type);
+}
+
+HighsInt Highs_stopCallback(void* highs, const int callback_type) {
+  return (HighsInt)((Highs*)highs)->stopCallback(callback_type);
+}
+
 double Highs_getRunTime(const void* highs) {
   return (double)((Highs*)highs)->getRunTime();
 }
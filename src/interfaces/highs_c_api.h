@@ -13,6 +13,7 @@
 #ifndef HIGHS_C_API
 #define HIGHS_C_API
 
+#include "lp_data/HighsCallbackStruct.h"
 #include "util/HighsInt.h"
 
 const HighsInt kHighsStatusError = -1;
@@ -76,6 +77,7 @@ const HighsInt kHighsModelStatusObjectiveTarget = 12;
 const HighsInt kHighsModelStatusTimeLimit = 13;
 const HighsInt kHighsModelStatusIterationLimit = 14;
 const HighsInt kHighsModelStatusUnknown = 15;
+const HighsInt kHighsModelStatusInterrupt = 16;
 
 const HighsInt kHighsBasisStatusLower = 0;
 const HighsInt kHighsBasisStatusBasic = 1;
@@ -83,6 +85,13 @@ const HighsInt kHighsBasisStatusUpper = 2;
 const HighsInt kHighsBasisStatusZero = 3;
 const HighsInt kHighsBasisStatusNonbasic = 4;
 
+const HighsInt kHighsCallbackSimplexIteration = 0;
+const HighsInt kHighsCallbackIpmIteration = 1;
+const HighsInt kHighsCallbackPresolveComplete = 2;
+const HighsInt kHighsCallbackMipNode = 3;
+const HighsInt kHighsCallbackMipImprovingSolution = 4;
+const HighsInt kHighsCallbackMipCutRound = 5;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -277,6 +286,41 @@ HighsInt Highs_clearSolver(void* highs);
  */
 HighsInt Highs_run(void* highs);
 
+/**
+ * Solve a batch of LPs concurrently, using the options of a Highs instance
+ * but without changing its model. Rather than creating a Highs instance per
+ * LP, the solves share a pool of workspaces held by the instance.
+ *
+ * The LPs are passed as in `Highs_lpCall`, except that each argument is an
+ * array of length [num_lp], with an entry for each LP. The matrices of all the
+ * LPs have the same format, `a_format`. Any of the solution arrays may be
+ * NULL, as may its entry for any one LP, in which case that part of the
+ * solution is not returned.
+ *
+ * @param highs     a pointer to the Highs instance
+ * @param num_lp    the number of LPs in the batch
+ *
+ * @param model_status  array of length [num_lp], filled with the termination
+ *                      status of each LP in the form of a `kHighsModelStatus`
+ *                      constant
+ * @param objective_function_value  array of length [num_lp], filled with the
+ *                                  objective function value of each LP. May be
+ *                                  NULL
+ *
+ * @returns the worst `kHighsStatus` constant of the solves in the batch
+ */
+HighsInt Highs_solveLpBatch(
+    void* highs, const HighsInt num_lp, const HighsInt* num_col,
+    const HighsInt* num_row, const HighsInt* num_nz, const HighsInt a_format,
+    const HighsInt* sense, const double* offset, const double* const* col_cost,
+    const double* const* col_lower, const double* const* col_upper,
+    const double* const* row_lower, const double* const* row_upper,
+    const HighsInt* const* a_start, const HighsInt* const* a_index,
+    const double* const* a_value, double* const* col_value,
+    double* const* col_dual, double* const* row_value, double* const* row_dual,
+    HighsInt* const* col_basis_status, HighsInt* const* row_basis_status,
+    HighsInt* model_status, double* objective_function_value);
+
 /**
  * Write the solution information (including dual and basis status, if
  * available) to a file.
@@ -871,6 +915,42 @@ HighsInt Highs_setSolution(void* highs, const double* col_value,
                            const double* row_value, const double* col_dual,
                            const double* row_dual);
 
+/**
+ * Set the callback method to use for HiGHS. The callback is not
+ * called until a callback type is started with `Highs_startCallback`.
+ *
+ * @param highs               a pointer to the Highs instance
+ * @param user_callback       a pointer to the user callback function
+ * @param user_callback_data  a pointer to user data that is passed back
+ *                            to the callback
+ *
+ * @returns a `kHighsStatus` constant indicating whether the call succeeded
+ */
+HighsInt Highs_setCallback(void* highs, HighsCCallbackType user_callback,
+                           void* user_callback_data);
+
+/**
+ * Start callbacks of a particular type.
+ *
+ * @param highs          a pointer to the Highs instance
+ * @param callback_type  a `kHighsCallback` constant giving the callback
+ *                       type to start
+ *
+ * @returns a `kHighsStatus` constant indicating whether the call succeeded
+ */
+HighsInt Highs_startCallback(void* highs, const int callback_type);
+
+/**
+ * Stop callbacks of a particular type.
+ *
+ * @param highs          a pointer to the Highs instance
+ * @param callback_type  a `kHighsCallback` constant giving the callback
+ *                       type to stop
+ *
+ * @returns a `kHighsStatus` constant indicating whether the call succeeded
+ */
+HighsInt Highs_stopCallback(void* highs, const int callback_type);
+
 /**
  * Return the cumulative wall-clock time spent in `Highs_run`.
  *
@@ -5,6 +5,9 @@ from .highs import (
     SolutionStatus,
     BasisValidity,
     HighsModelStatus,
+    HighsCallbackType,
+    HighsCallbackDataOut,
+    HighsCallbackDataIn,
     HighsBasisStatus,
     HighsVarType,
     HighsStatus,
@@ -15,6 +18,7 @@ from .highs import (
     HighsModel,
     HighsSolution,
     HighsBasis,
+    HighsBatchResult,
     HighsInfo,
     HighsOptions,
     Highs,
@@ -5,6 +5,9 @@ from .highs_bindings import (
     SolutionStatus,
     BasisValidity,
     HighsModelStatus,
+    HighsCallbackType,
+    HighsCallbackDataOut,
+    HighsCallbackDataIn,
     HighsBasisStatus,
     HighsVarType,
     HighsStatus,
@@ -16,6 +19,7 @@ from .highs_bindings import (
     HighsModel,
     HighsSolution,
     HighsBasis,
+    HighsBatchResult,
     HighsInfo,
     HighsOptions,
     _Highs,
@@ -30,8 +34,14 @@ class Highs(_Highs):
     def __init__(self):
         super().__init__()
         self._log_callback_tuple = CallbackTuple()
+        self._callback_tuple = CallbackTuple()
 
     def setLogCallback(self, func, callback_data):
         self._log_callback_tuple.callback = func
         self._log_callback_tuple.callback_data = callback_data
         super().setLogCallback(self._log_callback_tuple)
+
+    def setCallback(self, func, callback_data):
+        self._callback_tuple.callback = func
+        self._callback_tuple.callback_data = callback_data
+        return super().setCallback(self._callback_tuple)
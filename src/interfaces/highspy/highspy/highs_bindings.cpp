@@ -158,6 +158,18 @@ HighsModelStatus highs_getModelStatus(Highs* h)
   return h->getModelStatus(); 
 }
 
+std::tuple<HighsStatus, std::vector<HighsBatchResult>> highs_solveBatch(Highs* h, const std::vector<HighsLp>& lps)
+{
+  std::vector<HighsBatchResult> results;
+  HighsStatus status;
+  {
+    // The batch is solved by scheduler threads that don't call back into Python
+    py::gil_scoped_release release;
+    status = h->solveBatch(lps, results);
+  }
+  return std::make_tuple(status, results);
+}
+
 bool highs_getDualRay(Highs* h, py::array_t<double> values)
 {
   bool has_dual_ray;
@@ -440,6 +452,29 @@ HighsStatus highs_setLogCallback(Highs* h, CallbackTuple* callback_tuple)
 }
 
 
+void py_callback(int callback_type, const std::string& message,
+		 const HighsCallbackDataOut* data_out,
+		 HighsCallbackDataIn* data_in, void* callback_data)
+{
+  CallbackTuple* callback_tuple = static_cast<CallbackTuple*>(callback_data);
+  callback_tuple->callback(callback_type, message, data_out, data_in,
+			   callback_tuple->callback_data);
+}
+
+
+HighsStatus highs_setCallback(Highs* h, CallbackTuple* callback_tuple)
+{
+  return h->setCallback(&py_callback, callback_tuple);
+}
+
+
+py::array_t<double> highs_callbackMipSolution(const HighsCallbackDataOut* data_out)
+{
+  // Copy, since the solution is only valid during the callback
+  return py::array_t<double>(data_out->mip_solution_size, data_out->mip_solution);
+}
+
+
 PYBIND11_MODULE(highs_bindings, m)
 {
   py::enum_<ObjSense>(m, "ObjSense")
@@ -475,7 +510,15 @@ PYBIND11_MODULE(highs_bindings, m)
     .value("kObjectiveTarget", HighsModelStatus::kObjectiveTarget)
     .value("kTimeLimit", HighsModelStatus::kTimeLimit)
     .value("kIterationLimit", HighsModelStatus::kIterationLimit)
-    .value("kUnknown", HighsModelStatus::kUnknown);
+    .value("kUnknown", HighsModelStatus::kUnknown)
+    .value("kInterrupt", HighsModelStatus::kInterrupt);
+  py::enum_<HighsCallbackType>(m, "HighsCallbackType")
+    .value("kCallbackSimplexIteration", HighsCallbackType::kCallbackSimplexIteration)
+    .value("kCallbackIpmIteration", HighsCallbackType::kCallbackIpmIteration)
+    .value("kCallbackPresolveComplete", HighsCallbackType::kCallbackPresolveComplete)
+    .value("kCallbackMipNode", HighsCallbackType::kCallbackMipNode)
+    .value("kCallbackMipImprovingSolution", HighsCallbackType::kCallbackMipImprovingSolution)
+    .value("kCallbackMipCutRound", HighsCallbackType::kCallbackMipCutRound);
   py::enum_<HighsBasisStatus>(m, "HighsBasisStatus")
     .value("kLower", HighsBasisStatus::kLower)
     .value("kBasic", HighsBasisStatus::kBasic)
@@ -497,6 +540,22 @@ PYBIND11_MODULE(highs_bindings, m)
     .value("kVerbose", HighsLogType::kVerbose)
     .value("kWarning", HighsLogType::kWarning)
     .value("kError", HighsLogType::kError);
+  py::class_<HighsCallbackDataOut>(m, "HighsCallbackDataOut")
+    .def_readonly("running_time", &HighsCallbackDataOut::running_time)
+    .def_readonly("simplex_iteration_count", &HighsCallbackDataOut::simplex_iteration_count)
+    .def_readonly("ipm_iteration_count", &HighsCallbackDataOut::ipm_iteration_count)
+    .def_readonly("objective_function_value", &HighsCallbackDataOut::objective_function_value)
+    .def_readonly("mip_node_count", &HighsCallbackDataOut::mip_node_count)
+    .def_readonly("mip_primal_bound", &HighsCallbackDataOut::mip_primal_bound)
+    .def_readonly("mip_dual_bound", &HighsCallbackDataOut::mip_dual_bound)
+    .def_readonly("mip_gap", &HighsCallbackDataOut::mip_gap)
+    .def_readonly("mip_cut_round", &HighsCallbackDataOut::mip_cut_round)
+    .def_property_readonly("mip_solution", &highs_callbackMipSolution)
+    .def_readonly("presolved_num_col", &HighsCallbackDataOut::presolved_num_col)
+    .def_readonly("presolved_num_row", &HighsCallbackDataOut::presolved_num_row)
+    .def_readonly("presolved_num_nz", &HighsCallbackDataOut::presolved_num_nz);
+  py::class_<HighsCallbackDataIn>(m, "HighsCallbackDataIn")
+    .def_readwrite("user_interrupt", &HighsCallbackDataIn::user_interrupt);
   py::class_<CallbackTuple>(m, "CallbackTuple")
     .def(py::init<>())
     .def(py::init<py::object, py::object>())
@@ -560,6 +619,14 @@ PYBIND11_MODULE(highs_bindings, m)
     .def_readwrite("debug_origin_name", &HighsBasis::debug_origin_name)
     .def_readwrite("col_status", &HighsBasis::col_status)
     .def_readwrite("row_status", &HighsBasis::row_status);
+  py::class_<HighsBatchResult>(m, "HighsBatchResult")
+    .def(py::init<>())
+    .def_readwrite("run_status", &HighsBatchResult::run_status)
+    .def_readwrite("model_status", &HighsBatchResult::model_status)
+    .def_readwrite("objective_function_value", &HighsBatchResult::objective_function_value)
+    .def_readwrite("simplex_iteration_count", &HighsBatchResult::simplex_iteration_count)
+    .def_readwrite("solution", &HighsBatchResult::solution)
+    .def_readwrite("basis", &HighsBatchResult::basis);
   py::class_<HighsInfo>(m, "HighsInfo")
     .def(py::init<>())
     .def_readwrite("valid", &HighsInfo::valid)
@@ -568,6 +635,7 @@ PYBIND11_MODULE(highs_bindings, m)
     .def_readwrite("ipm_iteration_count", &HighsInfo::ipm_iteration_count)
     .def_readwrite("qp_iteration_count", &HighsInfo::qp_iteration_count)
     .def_readwrite("crossover_iteration_count", &HighsInfo::crossover_iteration_count)
+    .def_readwrite("work_units", &HighsInfo::work_units)
     .def_readwrite("primal_solution_status", &HighsInfo::primal_solution_status)
     .def_readwrite("dual_solution_status", &HighsInfo::dual_solution_status)
     .def_readwrite("basis_validity", &HighsInfo::basis_validity)
@@ -597,6 +665,7 @@ PYBIND11_MODULE(highs_bindings, m)
     .def_readwrite("ipm_optimality_tolerance", &HighsOptions::ipm_optimality_tolerance)
     .def_readwrite("objective_bound", &HighsOptions::objective_bound)
     .def_readwrite("objective_target", &HighsOptions::objective_target)
+    .def_readwrite("work_limit", &HighsOptions::work_limit)
     .def_readwrite("random_seed", &HighsOptions::random_seed)
     .def_readwrite("threads", &HighsOptions::threads)
     .def_readwrite("highs_debug_level", &HighsOptions::highs_debug_level)
@@ -611,6 +680,7 @@ PYBIND11_MODULE(highs_bindings, m)
     .def_readwrite("simplex_min_concurrency", &HighsOptions::simplex_min_concurrency)
     .def_readwrite("simplex_max_concurrency", &HighsOptions::simplex_max_concurrency)
     .def_readwrite("ipm_iteration_limit", &HighsOptions::ipm_iteration_limit)
+    .def_readwrite("ipm_kkt_solver", &HighsOptions::ipm_kkt_solver)
     .def_readwrite("write_model_file", &HighsOptions::write_model_file)
     .def_readwrite("solution_file", &HighsOptions::solution_file)
     .def_readwrite("log_file", &HighsOptions::log_file)
@@ -637,6 +707,7 @@ PYBIND11_MODULE(highs_bindings, m)
     .def_readwrite("mip_pscost_minreliable", &HighsOptions::mip_pscost_minreliable)
     .def_readwrite("mip_min_cliquetable_entries_for_parallelism", &HighsOptions::mip_min_cliquetable_entries_for_parallelism)
     .def_readwrite("mip_report_level", &HighsOptions::mip_report_level)
+    .def_readwrite("mip_parallel_tree_search", &HighsOptions::mip_parallel_tree_search)
     .def_readwrite("mip_feasibility_tolerance", &HighsOptions::mip_feasibility_tolerance)
     .def_readwrite("mip_rel_gap", &HighsOptions::mip_rel_gap)
     .def_readwrite("mip_abs_gap", &HighsOptions::mip_abs_gap)
@@ -652,6 +723,7 @@ PYBIND11_MODULE(highs_bindings, m)
     .def("readModel", &Highs::readModel)
     .def("presolve", &Highs::presolve)
     .def("run", &Highs::run)
+    .def("solveBatch", &highs_solveBatch)
     .def("postsolve", &Highs::postsolve)
     .def("writeSolution", &highs_writeSolution)
     .def("readSolution", &Highs::readSolution)
@@ -692,6 +764,9 @@ PYBIND11_MODULE(highs_bindings, m)
     .def("changeColsIntegrality", &highs_changeColsIntegrality)
     .def("setLogCallback", &highs_setLogCallback)
     .def("setLogCallback", &highs_setLogCallback)
+    .def("setCallback", &highs_setCallback)
+    .def("startCallback", &Highs::startCallback)
+    .def("stopCallback", &Highs::stopCallback)
     .def("deleteVars", &highs_deleteVars)
     .def("deleteRows", &highs_deleteRows)
     .def("clear", &Highs::clear)
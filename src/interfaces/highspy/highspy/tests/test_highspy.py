@@ -210,6 +210,24 @@ class TestHighsPy(unittest.TestCase):
         h.run()
         h.checkSolutionFeasibility()
 
+    def test_solve_batch(self):
+        h = self.get_basic_model()
+        lps = []
+        for cost in [1, 2, 3]:
+            # getLp returns a copy of the incumbent LP
+            lp = h.getLp()
+            lp.col_cost_ = np.array([0, cost], dtype=np.double)
+            lps.append(lp)
+        status, results = h.solveBatch(lps)
+        self.assertEqual(status, highspy.HighsStatus.kOk)
+        self.assertEqual(len(results), 3)
+        for cost, result in zip([1, 2, 3], results):
+            self.assertEqual(result.model_status, highspy.HighsModelStatus.kOptimal)
+            self.assertAlmostEqual(result.objective_function_value, cost)
+            self.assertAlmostEqual(result.solution.col_value[1], 1)
+        # The incumbent model is unchanged
+        self.assertEqual(h.getModelStatus(), highspy.HighsModelStatus.kNotset)
+
     def test_log_callback(self):
         h = self.get_basic_model()
         h.setOptionValue('log_to_console', True)
@@ -231,3 +249,24 @@ class TestHighsPy(unittest.TestCase):
         out = out.getvalue()
         self.assertIn('got a log message:  HighsLogType.kInfo an instance of Foo Presolving model', out)
 
+
+    def test_callback_interrupt(self):
+        h = self.get_basic_model()
+        h.setOptionValue('presolve', 'off')
+        calls = []
+
+        def user_callback(callback_type, message, data_out, data_in, data):
+            calls.append(data_out.simplex_iteration_count)
+            data_in.user_interrupt = 1
+
+        h.setCallback(user_callback, None)
+        h.startCallback(highspy.HighsCallbackType.kCallbackSimplexIteration)
+        h.run()
+        self.assertEqual(len(calls), 1)
+        self.assertEqual(h.getModelStatus(), highspy.HighsModelStatus.kInterrupt)
+
+        h.stopCallback(highspy.HighsCallbackType.kCallbackSimplexIteration)
+        h.clearSolver()
+        h.run()
+        self.assertEqual(len(calls), 1)
+        self.assertEqual(h.getModelStatus(), highspy.HighsModelStatus.kOptimal)
@@ -0,0 +1,308 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/FilereaderHmodel.cpp
+ * @brief
+ */
+
+#include "io/FilereaderHmodel.h"
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+
+#ifdef ZLIB_FOUND
+#include "zstr.hpp"
+#endif
+
+namespace {
+
+const char kHmodelMagic[8] = {'H', 'i', 'G', 'H', 'S', 'm', 'o', 'd'};
+const uint32_t kHmodelVersion = 1;
+const uint32_t kHmodelByteOrder = 0x01020304;
+
+// Flags for the optional parts of the model
+const uint32_t kHmodelIntegrality = 1;
+const uint32_t kHmodelHessian = 2;
+const uint32_t kHmodelColNames = 4;
+const uint32_t kHmodelRowNames = 8;
+
+// The header has a size that is a multiple of 8 bytes so that all
+// blocks following it are aligned
+struct HmodelHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order;
+  uint32_t highs_int_size;
+  uint32_t flags;
+  int64_t num_col;
+  int64_t num_row;
+  int64_t num_nz;
+  int64_t hessian_dim;
+  int64_t hessian_num_nz;
+  int64_t names_size;
+  int32_t sense;
+  int32_t hessian_format;
+  double offset;
+};
+
+const size_t kHmodelAlignment = 8;
+
+size_t paddingSize(const size_t num_byte) {
+  return (kHmodelAlignment - num_byte % kHmodelAlignment) % kHmodelAlignment;
+}
+
+template <typename T>
+void writeBlock(std::ostream& f, const T* data, const size_t count) {
+  const size_t num_byte = count * sizeof(T);
+  if (num_byte) f.write(reinterpret_cast<const char*>(data), num_byte);
+  const char padding[kHmodelAlignment] = {};
+  f.write(padding, paddingSize(num_byte));
+}
+
+// Reads a block directly into the vector, returning false on failure
+template <typename T>
+bool readBlock(std::istream& f, std::vector<T>& data, const size_t count) {
+  data.resize(count);
+  const size_t num_byte = count * sizeof(T);
+  if (num_byte) f.read(reinterpret_cast<char*>(data.data()), num_byte);
+  char padding[kHmodelAlignment];
+  f.read(padding, paddingSize(num_byte));
+  return bool(f);
+}
+
+bool hasSuffix(const std::string& filename, const std::string& suffix) {
+  return filename.size() >= suffix.size() &&
+         filename.compare(filename.size() - suffix.size(), suffix.size(),
+                          suffix) == 0;
+}
+
+}  // namespace
+
+FilereaderRetcode FilereaderHmodel::readModelFromFile(
+    const HighsOptions& options, const std::string filename,
+    HighsModel& model) {
+  HighsLp& lp = model.lp_;
+  HighsHessian& hessian = model.hessian_;
+  std::unique_ptr<std::istream> file;
+  if (hasSuffix(filename, ".gz")) {
+#ifdef ZLIB_FOUND
+    try {
+      file.reset(new zstr::ifstream(filename, std::ios::in));
+    } catch (const strict_fstream::Exception& e) {
+      highsLogDev(options.log_options, HighsLogType::kInfo, e.what());
+      return FilereaderRetcode::kFileNotFound;
+    }
+#else
+    return FilereaderRetcode::kNotImplemented;
+#endif
+  } else {
+    std::ifstream* plain_file =
+        new std::ifstream(filename, std::ios::in | std::ios::binary);
+    file.reset(plain_file);
+    if (!plain_file->is_open()) return FilereaderRetcode::kFileNotFound;
+  }
+  std::istream& f = *file;
+
+  HmodelHeader header;
+  f.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if (!f || std::memcmp(header.magic, kHmodelMagic, sizeof(kHmodelMagic))) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "File %s is not a HiGHS model file\n", filename.c_str());
+    return FilereaderRetcode::kParserError;
+  }
+  if (header.version > kHmodelVersion ||
+      header.byte_order != kHmodelByteOrder ||
+      header.highs_int_size != sizeof(HighsInt)) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "HiGHS model file %s has version %d, byte order %x and "
+                 "integer size %d: expected version at most %d, byte order "
+                 "%x and integer size %d\n",
+                 filename.c_str(), (int)header.version,
+                 (unsigned)header.byte_order, (int)header.highs_int_size,
+                 (int)kHmodelVersion, (unsigned)kHmodelByteOrder,
+                 (int)sizeof(HighsInt));
+    return FilereaderRetcode::kParserError;
+  }
+  const bool has_hessian = header.flags & kHmodelHessian;
+  if (header.num_col < 0 || header.num_row < 0 || header.num_nz < 0 ||
+      header.names_size < 0 ||
+      (has_hessian &&
+       (header.hessian_dim != header.num_col || header.hessian_num_nz < 0))) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "HiGHS model file %s has inconsistent dimensions\n",
+                 filename.c_str());
+    return FilereaderRetcode::kParserError;
+  }
+
+  const HighsInt num_col = header.num_col;
+  const HighsInt num_row = header.num_row;
+  lp.num_col_ = num_col;
+  lp.num_row_ = num_row;
+  lp.sense_ = header.sense == (int32_t)ObjSense::kMaximize
+                  ? ObjSense::kMaximize
+                  : ObjSense::kMinimize;
+  lp.offset_ = header.offset;
+  lp.setMatrixDimensions();
+  lp.a_matrix_.format_ = MatrixFormat::kColwise;
+  bool ok = readBlock(f, lp.col_cost_, num_col) &&
+            readBlock(f, lp.col_lower_, num_col) &&
+            readBlock(f, lp.col_upper_, num_col) &&
+            readBlock(f, lp.row_lower_, num_row) &&
+            readBlock(f, lp.row_upper_, num_row) &&
+            readBlock(f, lp.a_matrix_.start_, num_col + 1) &&
+            readBlock(f, lp.a_matrix_.index_, header.num_nz) &&
+            readBlock(f, lp.a_matrix_.value_, header.num_nz);
+  if (ok && (header.flags & kHmodelIntegrality))
+    ok = readBlock(f, lp.integrality_, num_col);
+  if (ok && has_hessian) {
+    hessian.dim_ = header.hessian_dim;
+    hessian.format_ = header.hessian_format == (int32_t)HessianFormat::kSquare
+                          ? HessianFormat::kSquare
+                          : HessianFormat::kTriangular;
+    ok = readBlock(f, hessian.start_, header.hessian_dim + 1) &&
+         readBlock(f, hessian.index_, header.hessian_num_nz) &&
+         readBlock(f, hessian.value_, header.hessian_num_nz);
+  }
+  std::vector<char> names;
+  if (ok) ok = readBlock(f, names, header.names_size);
+  if (!ok || lp.a_matrix_.start_[num_col] != header.num_nz ||
+      (names.size() && names.back() != '\0')) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "HiGHS model file %s is truncated or corrupt\n",
+                 filename.c_str());
+    return FilereaderRetcode::kParserError;
+  }
+
+  // The names are NUL-terminated, so can be extracted in turn
+  const char* name = names.data();
+  const char* names_end = names.data() + names.size();
+  auto nextName = [&]() -> std::string {
+    if (name == names_end) return "";
+    std::string next(name);
+    name += next.size() + 1;
+    return next;
+  };
+  lp.objective_name_ = nextName();
+  if (header.flags & kHmodelColNames) {
+    lp.col_names_.resize(num_col);
+    for (HighsInt iCol = 0; iCol < num_col; iCol++)
+      lp.col_names_[iCol] = nextName();
+  }
+  if (header.flags & kHmodelRowNames) {
+    lp.row_names_.resize(num_row);
+    for (HighsInt iRow = 0; iRow < num_row; iRow++)
+      lp.row_names_[iRow] = nextName();
+  }
+  return FilereaderRetcode::kOk;
+}
+
+HighsStatus FilereaderHmodel::writeModelToFile(const HighsOptions& options,
+                                               const std::string filename,
+                                               const HighsModel& model) {
+  const HighsLp& lp = model.lp_;
+  const HighsHessian& hessian = model.hessian_;
+  assert(lp.a_matrix_.isColwise());
+  std::unique_ptr<std::ostream> file;
+  if (hasSuffix(filename, ".gz")) {
+#ifdef ZLIB_FOUND
+    try {
+      file.reset(new zstr::ofstream(filename, std::ios::out));
+    } catch (const strict_fstream::Exception&) {
+      highsLogUser(options.log_options, HighsLogType::kError,
+                   "Cannot open file %s\n", filename.c_str());
+      return HighsStatus::kError;
+    }
+#else
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "HiGHS build without zlib support. Cannot write .gz file.\n");
+    return HighsStatus::kError;
+#endif
+  } else {
+    std::ofstream* plain_file =
+        new std::ofstream(filename, std::ios::out | std::ios::binary);
+    file.reset(plain_file);
+    if (!plain_file->is_open()) {
+      highsLogUser(options.log_options, HighsLogType::kError,
+                   "Cannot open file %s\n", filename.c_str());
+      return HighsStatus::kError;
+    }
+  }
+  std::ostream& f = *file;
+
+  const HighsInt num_col = lp.num_col_;
+  const HighsInt num_row = lp.num_row_;
+  const bool has_integrality = lp.integrality_.size() > 0;
+  const bool has_hessian = hessian.dim_ > 0;
+  const bool has_col_names = lp.col_names_.size() > 0;
+  const bool has_row_names = lp.row_names_.size() > 0;
+
+  // Gather the names, each terminated by NUL
+  std::vector<char> names;
+  auto addName = [&](const std::string& name) {
+    names.insert(names.end(), name.begin(), name.end());
+    names.push_back('\0');
+  };
+  addName(lp.objective_name_);
+  if (has_col_names)
+    for (HighsInt iCol = 0; iCol < num_col; iCol++)
+      addName(lp.col_names_[iCol]);
+  if (has_row_names)
+    for (HighsInt iRow = 0; iRow < num_row; iRow++)
+      addName(lp.row_names_[iRow]);
+
+  HmodelHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, kHmodelMagic, sizeof(kHmodelMagic));
+  header.version = kHmodelVersion;
+  header.byte_order = kHmodelByteOrder;
+  header.highs_int_size = sizeof(HighsInt);
+  header.flags = (has_integrality ? kHmodelIntegrality : 0) |
+                 (has_hessian ? kHmodelHessian : 0) |
+                 (has_col_names ? kHmodelColNames : 0) |
+                 (has_row_names ? kHmodelRowNames : 0);
+  header.num_col = num_col;
+  header.num_row = num_row;
+  header.num_nz = lp.a_matrix_.numNz();
+  header.hessian_dim = has_hessian ? hessian.dim_ : 0;
+  header.hessian_num_nz = has_hessian ? hessian.numNz() : 0;
+  header.names_size = names.size();
+  header.sense = (int32_t)lp.sense_;
+  header.hessian_format = (int32_t)hessian.format_;
+  header.offset = lp.offset_;
+  f.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+  writeBlock(f, lp.col_cost_.data(), num_col);
+  writeBlock(f, lp.col_lower_.data(), num_col);
+  writeBlock(f, lp.col_upper_.data(), num_col);
+  writeBlock(f, lp.row_lower_.data(), num_row);
+  writeBlock(f, lp.row_upper_.data(), num_row);
+  writeBlock(f, lp.a_matrix_.start_.data(), num_col + 1);
+  writeBlock(f, lp.a_matrix_.index_.data(), header.num_nz);
+  writeBlock(f, lp.a_matrix_.value_.data(), header.num_nz);
+  if (has_integrality) writeBlock(f, lp.integrality_.data(), num_col);
+  if (has_hessian) {
+    writeBlock(f, hessian.start_.data(), hessian.dim_ + 1);
+    writeBlock(f, hessian.index_.data(), header.hessian_num_nz);
+    writeBlock(f, hessian.value_.data(), header.hessian_num_nz);
+  }
+  writeBlock(f, names.data(), names.size());
+  f.flush();
+  if (!f) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "Error writing file %s\n", filename.c_str());
+    return HighsStatus::kError;
+  }
+  return HighsStatus::kOk;
+}
@@ -0,0 +1,48 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/FilereaderHmodel.h
+ * @brief Binary snapshot of a HighsModel
+ *
+ * A .hmodel file starts with a fixed size header, giving the format
+ * version, the size of HighsInt, the dimensions of the model and
+ * flags for its optional parts. This is followed by the arrays of
+ * the model as contiguous blocks, each padded to a multiple of 8
+ * bytes, in the order
+ *
+ * col_cost, col_lower, col_upper, row_lower, row_upper,
+ * a_matrix start, index and value (column-wise),
+ * integrality (if any), Hessian start, index and value (if any),
+ * names (if any) as the NUL-terminated objective, column and row names
+ *
+ * Values are stored in the byte order of the machine that writes the
+ * file, and files are only read on machines of the same byte order
+ * and HighsInt size. A .hmodel.gz file is compressed using zlib.
+ */
+
+#ifndef IO_FILEREADER_HMODEL_H_
+#define IO_FILEREADER_HMODEL_H_
+
+#include "io/Filereader.h"
+#include "io/HighsIO.h"  // For messages.
+
+class FilereaderHmodel : public Filereader {
+ public:
+  FilereaderRetcode readModelFromFile(const HighsOptions& options,
+                                      const std::string filename,
+                                      HighsModel& model);
+  HighsStatus writeModelToFile(const HighsOptions& options,
+                               const std::string filename,
+                               const HighsModel& model);
+};
+
+#endif
@@ -13,7 +13,17 @@
 
 #include "io/HMpsFF.h"
 
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "lp_data/HighsModelUtils.h"
+#include "parallel/HighsParallel.h"
 
 #ifdef ZLIB_FOUND
 #include "zstr.hpp"
@@ -131,44 +141,16 @@ FreeFormatParserReturnCode HMpsFF::loadProblem(
 }
 
 HighsInt HMpsFF::fillMatrix(const HighsLogOptions& log_options) {
-  HighsInt num_entries = entries.size();
-  if (num_entries != num_nz) return 1;
-
-  a_value.resize(num_nz);
-  a_index.resize(num_nz);
-  a_start.assign(num_col + 1, 0);
-  // Nothing to do if there are no entries in the matrix
-  if (!num_entries) return 0;
-
-  HighsInt newColIndex = std::get<0>(entries.at(0));
-
-  for (HighsInt k = 0; k < num_nz; k++) {
-    a_value.at(k) = std::get<2>(entries.at(k));
-    a_index.at(k) = std::get<1>(entries.at(k));
-
-    if (std::get<0>(entries.at(k)) != newColIndex) {
-      HighsInt nEmptyCols = std::get<0>(entries.at(k)) - newColIndex;
-      newColIndex = std::get<0>(entries.at(k));
-      if (newColIndex >= num_col) return 1;
-
-      a_start.at(newColIndex) = k;
-      for (HighsInt i = 1; i < nEmptyCols; i++) {
-        a_start.at(newColIndex - i) = k;
-      }
-    }
-  }
-
-  for (HighsInt col = newColIndex + 1; col <= num_col; col++)
-    a_start[col] = num_nz;
-
-  for (HighsInt i = 0; i < num_col; i++) {
-    if (a_start[i] > a_start[i + 1]) {
-      highsLogUser(log_options, HighsLogType::kError,
-                   "Non-monotonic starts in MPS file reader\n");
-      return 1;
-    }
+  // The nonzeros of the COLUMNS section are stored column-wise as they are
+  // read, so only the starts of columns that are first defined in later
+  // sections remain to be set
+  if ((HighsInt)a_index.size() != num_nz ||
+      (HighsInt)a_start.size() > num_col) {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "Inconsistent matrix in MPS file reader\n");
+    return 1;
   }
-
+  a_start.resize(num_col + 1, num_nz);
   return 0;
 }
 
@@ -212,12 +194,52 @@ HighsInt HMpsFF::fillHessian(const HighsLogOptions& log_options) {
   return 0;
 }
 
+HMpsFileMap::~HMpsFileMap() {
+#ifndef _WIN32
+  if (data_) munmap(data_, size_);
+#endif
+}
+
+bool HMpsFileMap::open(const std::string& filename) {
+#ifdef _WIN32
+  return false;
+#else
+  int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) return false;
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+    ::close(fd);
+    return false;
+  }
+  size_ = file_stat.st_size;
+  void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (data == MAP_FAILED) return false;
+  data_ = data;
+  char* begin = static_cast<char*>(data_);
+  // Compressed files are read through the stream
+  if (size_ >= 2 && (unsigned char)begin[0] == 0x1f &&
+      (unsigned char)begin[1] == 0x8b) {
+    munmap(data_, size_);
+    data_ = nullptr;
+    return false;
+  }
+  madvise(data_, size_, MADV_SEQUENTIAL);
+  setg(begin, begin, begin + size_);
+  return true;
+#endif
+}
+
 FreeFormatParserReturnCode HMpsFF::parse(const HighsLogOptions& log_options,
                                          const std::string& filename) {
-  HMpsFF::Parsekey keyword = HMpsFF::Parsekey::kNone;
-
   highsLogDev(log_options, HighsLogType::kInfo,
               "readMPS: Trying to open file %s\n", filename.c_str());
+  // Uncompressed files are memory mapped
+  HMpsFileMap file_map;
+  if (file_map.open(filename)) {
+    std::istream f(&file_map);
+    return parseSections(log_options, f, &file_map);
+  }
 #ifdef ZLIB_FOUND
   zstr::ifstream f;
   try {
@@ -230,89 +252,91 @@ FreeFormatParserReturnCode HMpsFF::parse(const HighsLogOptions& log_options,
   std::ifstream f;
   f.open(filename.c_str(), std::ios::in);
 #endif
-  if (f.is_open()) {
-    start_time = getWallTime();
-    num_row = 0;
-    num_col = 0;
-    num_nz = 0;
-    cost_row_location = -1;
-    // Indicate that no duplicate rows or columns have been found
-    has_duplicate_row_name_ = false;
-    has_duplicate_col_name_ = false;
-    // parsing loop
-    while (keyword != HMpsFF::Parsekey::kFail &&
-           keyword != HMpsFF::Parsekey::kEnd &&
-           keyword != HMpsFF::Parsekey::kTimeout) {
-      if (cannotParseSection(log_options, keyword)) {
-        f.close();
-        return FreeFormatParserReturnCode::kParserError;
-      }
-      switch (keyword) {
-        case HMpsFF::Parsekey::kObjsense:
-          keyword = parseObjsense(log_options, f);
-          break;
-        case HMpsFF::Parsekey::kRows:
-          keyword = parseRows(log_options, f);
-          break;
-        case HMpsFF::Parsekey::kCols:
-          keyword = parseCols(log_options, f);
-          break;
-        case HMpsFF::Parsekey::kRhs:
-          keyword = parseRhs(log_options, f);
-          break;
-        case HMpsFF::Parsekey::kBounds:
-          keyword = parseBounds(log_options, f);
-          break;
-        case HMpsFF::Parsekey::kRanges:
-          keyword = parseRanges(log_options, f);
-          break;
-        case HMpsFF::Parsekey::kQmatrix:
-        case HMpsFF::Parsekey::kQuadobj:
-          keyword = parseHessian(log_options, f, keyword);
-          break;
-        case HMpsFF::Parsekey::kQsection:
-        case HMpsFF::Parsekey::kQcmatrix:
-          keyword = parseQuadRows(log_options, f, keyword);
-          break;
-        case HMpsFF::Parsekey::kCsection:
-          keyword = parseCones(log_options, f);
-          break;
-        case HMpsFF::Parsekey::kSets:
-        case HMpsFF::Parsekey::kSos:
-          keyword = parseSos(log_options, f, keyword);
-          break;
-        case HMpsFF::Parsekey::kFail:
-          f.close();
-          return FreeFormatParserReturnCode::kParserError;
-        case HMpsFF::Parsekey::kFixedFormat:
-          f.close();
-          return FreeFormatParserReturnCode::kFixedFormat;
-        default:
-          keyword = parseDefault(log_options, f);
-          break;
-      }
-    }
-
-    // Assign bounds to columns that remain binary by default
-    for (HighsInt colidx = 0; colidx < num_col; colidx++) {
-      if (col_binary[colidx]) {
-        col_lower[colidx] = 0.0;
-        col_upper[colidx] = 1.0;
-      }
-    }
-
-    if (keyword == HMpsFF::Parsekey::kFail) {
-      f.close();
-      return FreeFormatParserReturnCode::kParserError;
-    }
-  } else {
+  if (!f.is_open()) {
     highsLogDev(log_options, HighsLogType::kInfo,
                 "readMPS: Not opened file OK\n");
     f.close();
     return FreeFormatParserReturnCode::kFileNotFound;
   }
-
+  FreeFormatParserReturnCode result = parseSections(log_options, f, nullptr);
   f.close();
+  return result;
+}
+
+FreeFormatParserReturnCode HMpsFF::parseSections(
+    const HighsLogOptions& log_options, std::istream& f,
+    HMpsFileMap* file_map) {
+  HMpsFF::Parsekey keyword = HMpsFF::Parsekey::kNone;
+
+  start_time = getWallTime();
+  num_row = 0;
+  num_col = 0;
+  num_nz = 0;
+  cost_row_location = -1;
+  // Indicate that no duplicate rows or columns have been found
+  has_duplicate_row_name_ = false;
+  has_duplicate_col_name_ = false;
+  // parsing loop
+  while (keyword != HMpsFF::Parsekey::kFail &&
+         keyword != HMpsFF::Parsekey::kEnd &&
+         keyword != HMpsFF::Parsekey::kTimeout) {
+    if (cannotParseSection(log_options, keyword))
+      return FreeFormatParserReturnCode::kParserError;
+    switch (keyword) {
+      case HMpsFF::Parsekey::kObjsense:
+        keyword = parseObjsense(log_options, f);
+        break;
+      case HMpsFF::Parsekey::kRows:
+        keyword = parseRows(log_options, f);
+        break;
+      case HMpsFF::Parsekey::kCols:
+        keyword = file_map ? parseColsMapped(log_options, *file_map)
+                           : parseCols(log_options, f);
+        break;
+      case HMpsFF::Parsekey::kRhs:
+        keyword = parseRhs(log_options, f);
+        break;
+      case HMpsFF::Parsekey::kBounds:
+        keyword = parseBounds(log_options, f);
+        break;
+      case HMpsFF::Parsekey::kRanges:
+        keyword = parseRanges(log_options, f);
+        break;
+      case HMpsFF::Parsekey::kQmatrix:
+      case HMpsFF::Parsekey::kQuadobj:
+        keyword = parseHessian(log_options, f, keyword);
+        break;
+      case HMpsFF::Parsekey::kQsection:
+      case HMpsFF::Parsekey::kQcmatrix:
+        keyword = parseQuadRows(log_options, f, keyword);
+        break;
+      case HMpsFF::Parsekey::kCsection:
+        keyword = parseCones(log_options, f);
+        break;
+      case HMpsFF::Parsekey::kSets:
+      case HMpsFF::Parsekey::kSos:
+        keyword = parseSos(log_options, f, keyword);
+        break;
+      case HMpsFF::Parsekey::kFail:
+        return FreeFormatParserReturnCode::kParserError;
+      case HMpsFF::Parsekey::kFixedFormat:
+        return FreeFormatParserReturnCode::kFixedFormat;
+      default:
+        keyword = parseDefault(log_options, f);
+        break;
+    }
+  }
+
+  // Assign bounds to columns that remain binary by default
+  for (HighsInt colidx = 0; colidx < num_col; colidx++) {
+    if (col_binary[colidx]) {
+      col_lower[colidx] = 0.0;
+      col_upper[colidx] = 1.0;
+    }
+  }
+
+  if (keyword == HMpsFF::Parsekey::kFail)
+    return FreeFormatParserReturnCode::kParserError;
 
   if (keyword == HMpsFF::Parsekey::kTimeout)
     return FreeFormatParserReturnCode::kTimeout;
@@ -434,11 +458,11 @@ HMpsFF::Parsekey HMpsFF::checkFirstWord(std::string& strline, HighsInt& start,
 HighsInt HMpsFF::getColIdx(const std::string& colname, const bool add_if_new) {
   // look up column name
   auto mit = colname2idx.find(colname);
-  if (mit != colname2idx.end()) return mit->second;
+  if (mit != nullptr) return *mit;
 
   if (!add_if_new) return -1;
   // add new continuous column with default bounds
-  colname2idx.emplace(colname, num_col++);
+  colname2idx.insert(colname, num_col++);
   col_names.push_back(colname);
   col_integrality.push_back(HighsVarType::kContinuous);
   col_binary.push_back(false);
@@ -556,7 +580,7 @@ HMpsFF::Parsekey HMpsFF::parseRows(const HighsLogOptions& log_options,
       if (!hasobj) {
         highsLogUser(log_options, HighsLogType::kWarning,
                      "No objective row found\n");
-        rowname2idx.emplace("artificial_empty_objective", -1);
+        rowname2idx.insert("artificial_empty_objective", -1);
       };
       return key;
     }
@@ -603,15 +627,14 @@ HMpsFF::Parsekey HMpsFF::parseRows(const HighsLogOptions& log_options,
 
     // Do not add to matrix if row is free.
     if (isFreeRow) {
-      rowname2idx.emplace(rowname, -2);
+      rowname2idx.insert(rowname, -2);
       continue;
     }
 
     // so in rowname2idx -1 is the objective, -2 is all the free rows
-    auto ret = rowname2idx.emplace(rowname, isobj ? (-1) : (num_row++));
-    // ret is a pair consisting of an iterator to the inserted
-    // element (or the already-existing element if no insertion
-    // happened) and a bool denoting whether the insertion took place
+    // inserted is false if the name is already in the table, in which case
+    // the index of the first occurrence is kept
+    bool inserted = rowname2idx.insert(rowname, isobj ? (-1) : (num_row++));
 
     // Else is enough here because all free rows are ignored.
     if (!isobj)
@@ -619,15 +642,15 @@ HMpsFF::Parsekey HMpsFF::parseRows(const HighsLogOptions& log_options,
     else
       objective_name = rowname;
 
-    if (!ret.second) {
+    if (!inserted) {
       // Duplicate row name
       if (!has_duplicate_row_name_) {
         // This is the first so record it
         has_duplicate_row_name_ = true;
         auto mit = rowname2idx.find(rowname);
-        assert(mit != rowname2idx.end());
+        assert(mit != nullptr);
         duplicate_row_name_ = rowname;
-        duplicate_row_name_index0_ = mit->second;
+        duplicate_row_name_index0_ = *mit;
         duplicate_row_name_index1_ = num_row - 1;
       }
     }
@@ -645,30 +668,12 @@ HMpsFF::Parsekey HMpsFF::parseRows(const HighsLogOptions& log_options,
 
 typename HMpsFF::Parsekey HMpsFF::parseCols(const HighsLogOptions& log_options,
                                             std::istream& file) {
-  std::string colname = "";
   std::string strline, word;
-  HighsInt rowidx, start, end;
-  bool integral_cols = false;
+  HighsInt start, end;
   assert(num_col == 0);
-  // Define the scattered value vector, index vector and count
-  std::vector<double> col_value;
-  std::vector<HighsInt> col_index;
-  HighsInt col_count = 0;
-  double col_cost = 0;
-  col_value.assign(num_row, 0);
-  col_index.resize(num_row);
-
-  auto parseName = [&rowidx, this](std::string name) {
-    auto mit = rowname2idx.find(name);
-
-    assert(mit != rowname2idx.end());
-    rowidx = mit->second;
-
-    if (rowidx >= 0)
-      this->num_nz++;
-    else
-      assert(-1 == rowidx || -2 == rowidx);
-  };
+  ColumnsState state;
+  state.col_value.assign(num_row, 0);
+  state.col_index.resize(num_row);
 
   while (getline(file, strline)) {
     double current = getWallTime();
@@ -691,229 +696,412 @@ typename HMpsFF::Parsekey HMpsFF::parseCols(const HighsLogOptions& log_options,
 
     // start of new section?
     if (key != Parsekey::kNone) {
-      if (num_col) {
-        if (col_cost) {
-          coeffobj.push_back(std::make_pair(num_col - 1, col_cost));
-          col_cost = 0;
-        }
-        for (HighsInt iEl = 0; iEl < col_count; iEl++) {
-          const HighsInt iRow = col_index[iEl];
-          assert(col_value[iRow]);
-          entries.push_back(
-              std::make_tuple(num_col - 1, iRow, col_value[iRow]));
-          col_value[iRow] = 0;
-        }
-        col_count = 0;
-      }
-
+      finishColumn(state);
       highsLogDev(log_options, HighsLogType::kInfo,
                   "readMPS: Read COLUMNS OK\n");
       return key;
     }
 
-    // check for integrality marker
-    std::string marker = first_word(strline, end);
-    HighsInt end_marker = first_word_end(strline, end);
+    key = parseColumnsLine(log_options, strline, end, word, state);
+    if (key != Parsekey::kNone) return key;
+  }
 
-    if (marker == "'MARKER'") {
-      marker = first_word(strline, end_marker);
+  return Parsekey::kFail;
+}
 
-      if ((integral_cols && marker != "'INTEND'") ||
-          (!integral_cols && marker != "'INTORG'")) {
-        highsLogUser(
-            log_options, HighsLogType::kError,
-            "Integrality marker error in COLUMNS section of MPS file\n");
-        return Parsekey::kFail;
-      }
-      integral_cols = !integral_cols;
+HMpsFF::Parsekey HMpsFF::parseColumnsLine(const HighsLogOptions& log_options,
+                                          std::string& strline, HighsInt end,
+                                          const std::string& word,
+                                          ColumnsState& state) {
+  // check for integrality marker
+  std::string marker = first_word(strline, end);
+  HighsInt end_marker = first_word_end(strline, end);
 
-      continue;
+  if (marker == "'MARKER'") {
+    marker = first_word(strline, end_marker);
+
+    if ((state.integral_cols && marker != "'INTEND'") ||
+        (!state.integral_cols && marker != "'INTORG'")) {
+      highsLogUser(log_options, HighsLogType::kError,
+                   "Integrality marker error in COLUMNS section of MPS file\n");
+      return Parsekey::kFail;
     }
-    // Detect whether the file is in fixed format with spaces in
-    // names, even if there are no known examples!
-    //
-    // end_marker should be the end index of the row name:
-    //
-    // If the names are at least 8 characters, end_marker should be
-    // more than 13 minus the 4 whitespaces we have trimmed from the
-    // start so more than 9
-    //
-    // However, free format MPS can have names with only one character
-    // (pyomo.mps). Have to distinguish this from 8-character names
-    // with spaces. Best bet is to see whether "marker" is in the set
-    // of row names. If it is, then assume that the names are short
-    if (end_marker < 9) {
-      auto mit = rowname2idx.find(marker);
-      if (mit == rowname2idx.end()) {
-        // marker is not a row name, so continue to look at name
-        std::string name = strline.substr(0, 10);
-        // Delete trailing spaces
-        name = trim(name);
-        if (name.size() > 8) {
-          highsLogUser(log_options, HighsLogType::kError,
-                       "Row name \"%s\" with spaces exceeds fixed format name "
-                       "length of 8\n",
-                       name.c_str());
-          return HMpsFF::Parsekey::kFail;
-        } else {
-          highsLogUser(log_options, HighsLogType::kWarning,
-                       "Row name \"%s\" with spaces has length %d, so assume "
-                       "fixed format\n",
-                       name.c_str(), (int)name.size());
-          return HMpsFF::Parsekey::kFixedFormat;
-        }
+    state.integral_cols = !state.integral_cols;
+
+    return Parsekey::kNone;
+  }
+  // Detect whether the file is in fixed format with spaces in
+  // names, even if there are no known examples!
+  //
+  // end_marker should be the end index of the row name:
+  //
+  // If the names are at least 8 characters, end_marker should be
+  // more than 13 minus the 4 whitespaces we have trimmed from the
+  // start so more than 9
+  //
+  // However, free format MPS can have names with only one character
+  // (pyomo.mps). Have to distinguish this from 8-character names
+  // with spaces. Best bet is to see whether "marker" is in the set
+  // of row names. If it is, then assume that the names are short
+  if (end_marker < 9) {
+    if (rowname2idx.find(marker) == nullptr) {
+      // marker is not a row name, so continue to look at name
+      std::string name = strline.substr(0, 10);
+      // Delete trailing spaces
+      name = trim(name);
+      if (name.size() > 8) {
+        highsLogUser(log_options, HighsLogType::kError,
+                     "Row name \"%s\" with spaces exceeds fixed format name "
+                     "length of 8\n",
+                     name.c_str());
+        return HMpsFF::Parsekey::kFail;
+      } else {
+        highsLogUser(log_options, HighsLogType::kWarning,
+                     "Row name \"%s\" with spaces has length %d, so assume "
+                     "fixed format\n",
+                     name.c_str(), (int)name.size());
+        return HMpsFF::Parsekey::kFixedFormat;
       }
     }
+  }
 
-    // Test for new column
-    if (!(word == colname)) {
-      // Record the nonzeros in any previous column
-      if (num_col) {
-        if (col_cost) {
-          coeffobj.push_back(std::make_pair(num_col - 1, col_cost));
-          col_cost = 0;
-        }
-        for (HighsInt iEl = 0; iEl < col_count; iEl++) {
-          const HighsInt iRow = col_index[iEl];
-          assert(col_value[iRow]);
-          entries.push_back(
-              std::make_tuple(num_col - 1, iRow, col_value[iRow]));
-          col_value[iRow] = 0;
-        }
-        col_count = 0;
-      }
-      assert(!col_cost);
-      colname = word;
-      auto ret = colname2idx.emplace(colname, num_col++);
-      col_names.push_back(colname);
-      if (!ret.second) {
-        // Duplicate col name
-        if (!has_duplicate_col_name_) {
-          // This is the first so record it
-          has_duplicate_col_name_ = true;
-          auto mit = colname2idx.find(colname);
-          assert(mit != colname2idx.end());
-          duplicate_col_name_ = colname;
-          duplicate_col_name_index0_ = mit->second;
-          duplicate_col_name_index1_ = num_col - 1;
-        }
-      }
+  // Test for new column
+  if (!(word == state.colname)) startColumn(state, word);
 
-      // Mark the column as integer, according to whether
-      // the integral_cols flag is set
-      col_integrality.push_back(integral_cols ? HighsVarType::kInteger
-                                              : HighsVarType::kContinuous);
-      // Mark the column as binary as well
-      col_binary.push_back(integral_cols && kintegerVarsInColumnsAreBinary);
+  assert(num_col > 0);
 
-      // initialize with default bounds
-      col_lower.push_back(0.0);
-      col_upper.push_back(kHighsInf);
-    }
+  // here marker is the row name and end marks its end
+  std::string value_word = first_word(strline, end_marker);
+  end = first_word_end(strline, end_marker);
 
-    assert(num_col > 0);
+  if (value_word == "") {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "No coefficient given for column \"%s\"\n", marker.c_str());
+    return HMpsFF::Parsekey::kFail;
+  }
 
-    // here marker is the row name and end marks its end
-    word = "";
-    word = first_word(strline, end_marker);
-    end = first_word_end(strline, end_marker);
+  auto mit = rowname2idx.find(marker);
+  if (mit == nullptr) {
+    highsLogUser(log_options, HighsLogType::kWarning,
+                 "Row name \"%s\" in COLUMNS section is not defined: ignored\n",
+                 marker.c_str());
+  } else {
+    addColumnEntry(log_options, state, *mit, atof(value_word.c_str()),
+                   marker);
+  }
 
-    if (word == "") {
+  if (!is_end(strline, end)) {
+    // parse second coefficient
+    marker = first_word(strline, end);
+    if (value_word == "") {
       highsLogUser(log_options, HighsLogType::kError,
                    "No coefficient given for column \"%s\"\n", marker.c_str());
       return HMpsFF::Parsekey::kFail;
     }
+    end_marker = first_word_end(strline, end);
+
+    // here marker is the row name and end marks its end
+    end_marker++;
+    value_word = first_word(strline, end_marker);
+    end = first_word_end(strline, end_marker);
+
+    assert(is_end(strline, end));
 
     auto mit = rowname2idx.find(marker);
-    if (mit == rowname2idx.end()) {
+    if (mit == nullptr) {
       highsLogUser(
           log_options, HighsLogType::kWarning,
           "Row name \"%s\" in COLUMNS section is not defined: ignored\n",
           marker.c_str());
+      return Parsekey::kNone;
+    };
+    addColumnEntry(log_options, state, *mit, atof(value_word.c_str()),
+                   marker);
+  }
+  return Parsekey::kNone;
+}
+
+void HMpsFF::startColumn(ColumnsState& state, const std::string& colname) {
+  // Record the nonzeros in any previous column
+  finishColumn(state);
+  assert(!state.col_cost);
+  state.colname = colname;
+  bool inserted = colname2idx.insert(colname, num_col++);
+  col_names.push_back(colname);
+  if (!inserted) {
+    // Duplicate col name
+    if (!has_duplicate_col_name_) {
+      // This is the first so record it
+      has_duplicate_col_name_ = true;
+      auto mit = colname2idx.find(colname);
+      assert(mit != nullptr);
+      duplicate_col_name_ = colname;
+      duplicate_col_name_index0_ = *mit;
+      duplicate_col_name_index1_ = num_col - 1;
+    }
+  }
+
+  // Mark the column as integer, according to whether
+  // the integral_cols flag is set
+  col_integrality.push_back(state.integral_cols ? HighsVarType::kInteger
+                                                : HighsVarType::kContinuous);
+  // Mark the column as binary as well
+  col_binary.push_back(state.integral_cols && kintegerVarsInColumnsAreBinary);
+
+  // initialize with default bounds
+  col_lower.push_back(0.0);
+  col_upper.push_back(kHighsInf);
+
+  // the nonzeros of the column follow those of the previous columns
+  a_start.push_back(a_index.size());
+}
+
+void HMpsFF::finishColumn(ColumnsState& state) {
+  if (!num_col) return;
+  if (state.col_cost) {
+    coeffobj.push_back(std::make_pair(num_col - 1, state.col_cost));
+    state.col_cost = 0;
+  }
+  for (HighsInt iEl = 0; iEl < state.col_count; iEl++) {
+    const HighsInt iRow = state.col_index[iEl];
+    assert(state.col_value[iRow]);
+    a_index.push_back(iRow);
+    a_value.push_back(state.col_value[iRow]);
+    state.col_value[iRow] = 0;
+  }
+  state.col_count = 0;
+}
+
+// Adds a nonzero to the current column. In rowname2idx, -1 is the
+// objective and -2 is all the free rows, whose entries are ignored
+void HMpsFF::addColumnEntry(const HighsLogOptions& log_options,
+                            ColumnsState& state, const HighsInt rowidx,
+                            const double value, const std::string& rowname) {
+  if (!value) return;
+  if (rowidx >= 0) {
+    if (state.col_value[rowidx]) {
+      // Ignore duplicate entry
+      highsLogUser(log_options, HighsLogType::kWarning,
+                   "Column \"%s\" has duplicate nonzero in row \"%s\"\n",
+                   state.colname.c_str(), rowname.c_str());
     } else {
-      double value = atof(word.c_str());
-      if (value) {
-        parseName(marker);  // rowidx set and num_nz incremented
-        if (rowidx >= 0) {
-          if (col_value[rowidx]) {
-            // Ignore duplicate entry
-            num_nz--;
-            highsLogUser(log_options, HighsLogType::kWarning,
-                         "Column \"%s\" has duplicate nonzero in row \"%s\"\n",
-                         colname.c_str(), marker.c_str());
-          } else {
-            col_value[rowidx] = value;
-            col_index[col_count++] = rowidx;
-          }
-        } else if (rowidx == -1) {
-          // Ignore duplicate entry
-          if (col_cost) {
-            highsLogUser(log_options, HighsLogType::kWarning,
-                         "Column \"%s\" has duplicate nonzero in row \"%s\"\n",
-                         colname.c_str(), objective_name.c_str());
-          } else {
-            col_cost = value;
-          }
+      num_nz++;
+      state.col_value[rowidx] = value;
+      state.col_index[state.col_count++] = rowidx;
+    }
+  } else if (rowidx == -1) {
+    // Ignore duplicate entry
+    if (state.col_cost) {
+      highsLogUser(log_options, HighsLogType::kWarning,
+                   "Column \"%s\" has duplicate nonzero in row \"%s\"\n",
+                   state.colname.c_str(), objective_name.c_str());
+    } else {
+      state.col_cost = value;
+    }
+  } else {
+    assert(-2 == rowidx);
+  }
+}
+
+// Size of the chunks of the COLUMNS section that are parsed concurrently
+const size_t kColumnsChunkSize = size_t{1} << 16;
+
+HMpsFF::Parsekey HMpsFF::parseColsMapped(const HighsLogOptions& log_options,
+                                         HMpsFileMap& file_map) {
+  std::string strline, word;
+  HighsInt start, end;
+  assert(num_col == 0);
+
+  // Find the line starting the next section. Since section keywords
+  // consist of capital letters, only lines starting with one are checked
+  const char* section_begin = file_map.position();
+  const char* file_end = file_map.end();
+  const char* section_end = file_end;
+  const char* next_section = file_end;
+  HMpsFF::Parsekey key = Parsekey::kFail;
+  for (const char* line = section_begin; line < file_end;) {
+    const char* line_end =
+        static_cast<const char*>(std::memchr(line, '\n', file_end - line));
+    if (line_end == nullptr) line_end = file_end;
+    if (*line != '*') {
+      const char* first = line;
+      while (first < line_end && is_empty(*first)) ++first;
+      if (first < line_end && *first >= 'A' && *first <= 'Z') {
+        strline.assign(line, line_end);
+        trim(strline);
+        key = checkFirstWord(strline, start, end, word);
+        if (key != Parsekey::kNone) {
+          section_end = line;
+          next_section = line_end < file_end ? line_end + 1 : file_end;
+          break;
         }
+        key = Parsekey::kFail;
       }
     }
+    line = line_end + 1;
+  }
 
-    if (!is_end(strline, end)) {
-      // parse second coefficient
-      marker = first_word(strline, end);
-      if (word == "") {
-        highsLogUser(log_options, HighsLogType::kError,
-                     "No coefficient given for column \"%s\"\n",
-                     marker.c_str());
-        return HMpsFF::Parsekey::kFail;
+  // Split the section into chunks of whole lines
+  std::vector<const char*> chunk_begin;
+  chunk_begin.push_back(section_begin);
+  for (const char* pos = section_begin + kColumnsChunkSize; pos < section_end;
+       pos += kColumnsChunkSize) {
+    const char* line_end =
+        static_cast<const char*>(std::memchr(pos, '\n', section_end - pos));
+    if (line_end == nullptr) break;
+    pos = line_end + 1;
+    if (pos >= section_end) break;
+    chunk_begin.push_back(pos);
+  }
+  HighsInt num_chunk = chunk_begin.size();
+  chunk_begin.push_back(section_end);
+
+  // Parse the chunks concurrently if the scheduler is running. The row
+  // names are only looked up, so the parser is not modified.
+  std::vector<std::vector<ColumnsLine>> chunk_lines(num_chunk);
+  std::vector<HighsInt> chunk_num_name(num_chunk);
+  auto parseChunks = [&](HighsInt first, HighsInt last) {
+    for (HighsInt k = first; k < last; k++)
+      chunk_num_name[k] = parseColumnsChunk(chunk_begin[k], chunk_begin[k + 1],
+                                            chunk_lines[k]);
+  };
+  if (num_chunk > 1 && HighsTaskExecutor::getThisWorkerDeque() != nullptr)
+    highs::parallel::for_each(0, num_chunk, parseChunks);
+  else
+    parseChunks(0, num_chunk);
+
+  // The number of distinct consecutive names bounds the number of columns,
+  // so size the column data accordingly
+  HighsInt max_num_col = 0;
+  size_t max_num_nz = 0;
+  for (HighsInt k = 0; k < num_chunk; k++) {
+    max_num_col += chunk_num_name[k];
+    max_num_nz += 2 * chunk_lines[k].size();
+  }
+  colname2idx = HighsHashTable<std::string, HighsInt>(max_num_col);
+  col_names.reserve(max_num_col);
+  col_integrality.reserve(max_num_col);
+  col_binary.reserve(max_num_col);
+  col_lower.reserve(max_num_col);
+  col_upper.reserve(max_num_col);
+  a_start.reserve(max_num_col + 1);
+  a_index.reserve(max_num_nz);
+  a_value.reserve(max_num_nz);
+
+  // Now add the columns in the order of the file
+  ColumnsState state;
+  state.col_value.assign(num_row, 0);
+  state.col_index.resize(num_row);
+  for (HighsInt k = 0; k < num_chunk; k++) {
+    double current = getWallTime();
+    if (time_limit > 0 && current - start_time > time_limit)
+      return HMpsFF::Parsekey::kTimeout;
+
+    for (const ColumnsLine& line : chunk_lines[k]) {
+      if (line.num_entry < 0) {
+        strline.assign(line.begin, line.length);
+        checkFirstWord(strline, start, end, word);
+        HMpsFF::Parsekey line_key =
+            parseColumnsLine(log_options, strline, end, word, state);
+        if (line_key != Parsekey::kNone) return line_key;
+        continue;
       }
-      end_marker = first_word_end(strline, end);
+      if (line.name_length != (HighsInt)state.colname.size() ||
+          std::memcmp(line.begin, state.colname.data(), line.name_length))
+        startColumn(state, std::string(line.begin, line.name_length));
+      for (HighsInt iEl = 0; iEl < line.num_entry; iEl++) {
+        const HighsInt rowidx = line.row[iEl];
+        addColumnEntry(log_options, state, rowidx, line.value[iEl],
+                       rowidx >= 0 ? row_names[rowidx] : objective_name);
+      }
+    }
+    std::vector<ColumnsLine>().swap(chunk_lines[k]);
+  }
+  if (key == Parsekey::kFail) return key;
 
-      // here marker is the row name and end marks its end
-      word = "";
-      end_marker++;
-      word = first_word(strline, end_marker);
-      end = first_word_end(strline, end_marker);
+  finishColumn(state);
+  file_map.setPosition(next_section);
+  highsLogDev(log_options, HighsLogType::kInfo, "readMPS: Read COLUMNS OK\n");
+  return key;
+}
 
-      assert(is_end(strline, end));
+HighsInt HMpsFF::parseColumnsChunk(const char* begin, const char* end,
+                                   std::vector<ColumnsLine>& lines) const {
+  // Longest value that is converted from the memory map
+  const HighsInt kMaxValueLength = 63;
+  char value_buffer[kMaxValueLength + 1];
+  std::string rowname;
+  HighsInt num_name = 0;
+  const char* last_name = nullptr;
+  HighsInt last_name_length = -1;
+
+  for (const char* line = begin; line < end;) {
+    const char* line_end =
+        static_cast<const char*>(std::memchr(line, '\n', end - line));
+    if (line_end == nullptr) line_end = end;
+    const char* next_line = line_end + 1;
+    // Just look for comment character in column 1
+    if (*line == '*') {
+      line = next_line;
+      continue;
+    }
+    // Trim the line
+    while (line < line_end && is_empty(*line)) ++line;
+    while (line_end > line && is_empty(*(line_end - 1))) --line_end;
+    if (line == line_end) {
+      line = next_line;
+      continue;
+    }
 
-      auto mit = rowname2idx.find(marker);
-      if (mit == rowname2idx.end()) {
-        highsLogUser(
-            log_options, HighsLogType::kWarning,
-            "Row name \"%s\" in COLUMNS section is not defined: ignored\n",
-            marker.c_str());
-        continue;
-      };
-      double value = atof(word.c_str());
-      if (value) {
-        parseName(marker);  // rowidx set and num_nz incremented
-        if (rowidx >= 0) {
-          if (col_value[rowidx]) {
-            // Ignore duplicate entry
-            num_nz--;
-            highsLogUser(log_options, HighsLogType::kWarning,
-                         "Column \"%s\" has duplicate nonzero in row \"%s\"\n",
-                         colname.c_str(), marker.c_str());
-          } else {
-            col_value[rowidx] = value;
-            col_index[col_count++] = rowidx;
-          }
-        } else if (rowidx == -1) {
-          // Ignore duplicate entry
-          if (col_cost) {
-            highsLogUser(log_options, HighsLogType::kWarning,
-                         "Column \"%s\" has duplicate nonzero in row \"%s\"\n",
-                         colname.c_str(), objective_name.c_str());
-          } else {
-            col_cost = value;
-          }
-        }
+    // Split the line into at most six words
+    const HighsInt kMaxWords = 6;
+    const char* word_begin[kMaxWords];
+    HighsInt word_length[kMaxWords];
+    HighsInt num_word = 0;
+    for (const char* pos = line; pos < line_end && num_word < kMaxWords;) {
+      const char* word_end = pos;
+      while (word_end < line_end && !is_empty(*word_end)) ++word_end;
+      word_begin[num_word] = pos;
+      word_length[num_word++] = word_end - pos;
+      pos = word_end;
+      while (pos < line_end && is_empty(*pos)) ++pos;
+    }
+
+    ColumnsLine parsed;
+    parsed.begin = line;
+    parsed.length = line_end - line;
+    parsed.name_length = word_length[0];
+    parsed.num_entry = -1;
+    if (num_word == 3 || num_word == 5) {
+      // Look up the row names and convert the values. Any line that is not
+      // of the usual form is parsed as text later
+      HighsInt num_entry = 0;
+      for (HighsInt iWord = 1; iWord < num_word; iWord += 2) {
+        rowname.assign(word_begin[iWord], word_length[iWord]);
+        if (rowname == "'MARKER'") break;
+        const HighsInt* rowidx = rowname2idx.find(rowname);
+        if (rowidx == nullptr) break;
+        if (word_length[iWord + 1] > kMaxValueLength) break;
+        std::memcpy(value_buffer, word_begin[iWord + 1],
+                    word_length[iWord + 1]);
+        value_buffer[word_length[iWord + 1]] = '\0';
+        parsed.row[num_entry] = *rowidx;
+        parsed.value[num_entry] = atof(value_buffer);
+        num_entry++;
       }
+      if (2 * num_entry + 1 == num_word) parsed.num_entry = num_entry;
     }
-  }
+    lines.push_back(parsed);
 
-  return Parsekey::kFail;
+    if (parsed.name_length != last_name_length ||
+        std::memcmp(line, last_name, parsed.name_length)) {
+      num_name++;
+      last_name = line;
+      last_name_length = parsed.name_length;
+    }
+    line = next_line;
+  }
+  return num_name;
 }
 
 HMpsFF::Parsekey HMpsFF::parseRhs(const HighsLogOptions& log_options,
@@ -924,8 +1112,8 @@ HMpsFF::Parsekey HMpsFF::parseRhs(const HighsLogOptions& log_options,
                           bool& has_entry) {
     auto mit = rowname2idx.find(name);
 
-    assert(mit != rowname2idx.end());
-    rowidx = mit->second;
+    assert(mit != nullptr);
+    rowidx = *mit;
 
     assert(rowidx < num_row);
 
@@ -995,7 +1183,7 @@ HMpsFF::Parsekey HMpsFF::parseRhs(const HighsLogOptions& log_options,
     // Ignore lack of name for SIF format;
     // we know we have this case when "word" is a row name
     if ((key == Parsekey::kNone) && (key != Parsekey::kRhs) &&
-        (rowname2idx.find(word) != rowname2idx.end())) {
+        (rowname2idx.find(word) != nullptr)) {
       end = begin;
     }
 
@@ -1021,7 +1209,7 @@ HMpsFF::Parsekey HMpsFF::parseRhs(const HighsLogOptions& log_options,
     // prepended to the RHS entry; remove it here if
     // that's the case. "word" will then hold the marker,
     // so also get new "word" and "end" values
-    if (mit == rowname2idx.end()) {
+    if (mit == nullptr) {
       if (marker == mps_name) {
         marker = word;
         end_marker = end;
@@ -1037,7 +1225,7 @@ HMpsFF::Parsekey HMpsFF::parseRhs(const HighsLogOptions& log_options,
       }
     }
 
-    if (mit == rowname2idx.end()) {
+    if (mit == nullptr) {
       highsLogUser(log_options, HighsLogType::kWarning,
                    "Row name \"%s\" in RHS section is not defined: ignored\n",
                    marker.c_str());
@@ -1074,7 +1262,7 @@ HMpsFF::Parsekey HMpsFF::parseRhs(const HighsLogOptions& log_options,
       assert(is_end(strline, end));
 
       auto mit = rowname2idx.find(marker);
-      if (mit == rowname2idx.end()) {
+      if (mit == nullptr) {
         highsLogUser(log_options, HighsLogType::kWarning,
                      "Row name \"%s\" in RHS section is not defined: ignored\n",
                      marker.c_str());
@@ -1245,7 +1433,7 @@ HMpsFF::Parsekey HMpsFF::parseBounds(const HighsLogOptions& log_options,
 
     std::string marker;
     HighsInt end_marker;
-    if (colname2idx.find(bound_name) != colname2idx.end()) {
+    if (colname2idx.find(bound_name) != nullptr) {
       // SIF format might not have the bound name, so skip
       // it here if we found the marker instead
       marker = bound_name;
@@ -1360,8 +1548,8 @@ HMpsFF::Parsekey HMpsFF::parseRanges(const HighsLogOptions& log_options,
   auto parseName = [this](const std::string& name, HighsInt& rowidx) {
     auto mit = rowname2idx.find(name);
 
-    assert(mit != rowname2idx.end());
-    rowidx = mit->second;
+    assert(mit != nullptr);
+    rowidx = *mit;
 
     assert(rowidx < num_row);
   };
@@ -1426,7 +1614,7 @@ HMpsFF::Parsekey HMpsFF::parseRanges(const HighsLogOptions& log_options,
     }
 
     auto mit = rowname2idx.find(marker);
-    if (mit == rowname2idx.end()) {
+    if (mit == nullptr) {
       highsLogUser(
           log_options, HighsLogType::kWarning,
           "Row name \"%s\" in RANGES section is not defined: ignored\n",
@@ -1465,7 +1653,7 @@ HMpsFF::Parsekey HMpsFF::parseRanges(const HighsLogOptions& log_options,
       }
 
       auto mit = rowname2idx.find(marker);
-      if (mit == rowname2idx.end()) {
+      if (mit == nullptr) {
         highsLogUser(
             log_options, HighsLogType::kWarning,
             "Row name \"%s\" in RANGES section is not defined: ignored\n",
@@ -1631,8 +1819,8 @@ typename HMpsFF::Parsekey HMpsFF::parseQuadRows(
 
   auto mit = rowname2idx.find(rowname);
   // if row of section does not exist or is free (index -2), then skip
-  if (mit == rowname2idx.end() || mit->second == -2) {
-    if (mit == rowname2idx.end())
+  if (mit == nullptr || *mit == -2) {
+    if (mit == nullptr)
       highsLogUser(log_options, HighsLogType::kWarning,
                    "Row name \"%s\" in %s section is not defined: ignored\n",
                    rowname.c_str(), section_name.c_str());
@@ -1651,7 +1839,7 @@ typename HMpsFF::Parsekey HMpsFF::parseQuadRows(
     }
     return Parsekey::kFail;  // unexpected end of file
   }
-  rowidx = mit->second;
+  rowidx = *mit;
   assert(rowidx >= -1);
   assert(rowidx < num_row);
 
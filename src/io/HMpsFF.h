@@ -28,14 +28,16 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <streambuf>
+#include <string>
 #include <tuple>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "io/HighsIO.h"
 #include "model/HighsModel.h"
 //#include "util/HighsInt.h"
+#include "util/HighsHash.h"
 #include "util/stringutil.h"
 
 using Triplet = std::tuple<HighsInt, HighsInt, double>;
@@ -56,6 +58,31 @@ using time_point = wall_clock::time_point;
 
 double getWallTime();
 
+// Read-only memory map of an uncompressed MPS file. As a stream buffer, it
+// allows the sections of the file to be read with std::getline as from a
+// file stream, while the COLUMNS section is parsed directly in memory.
+class HMpsFileMap : public std::streambuf {
+ public:
+  HMpsFileMap() {}
+  ~HMpsFileMap();
+  HMpsFileMap(const HMpsFileMap&) = delete;
+  HMpsFileMap& operator=(const HMpsFileMap&) = delete;
+
+  // Maps the file, returning false if this is not possible or if the file
+  // is compressed
+  bool open(const std::string& filename);
+
+  const char* end() const { return egptr(); }
+  const char* position() const { return gptr(); }
+  void setPosition(const char* pos) {
+    setg(eback(), const_cast<char*>(pos), egptr());
+  }
+
+ private:
+  void* data_ = nullptr;
+  size_t size_ = 0;
+};
+
 class HMpsFF {
  public:
   HMpsFF() {}
@@ -173,7 +200,6 @@ class HMpsFF {
   std::vector<Boundtype> row_type;
   std::vector<HighsInt> integer_column;
 
-  std::vector<Triplet> entries;
   std::vector<Triplet> q_entries;
   std::vector<std::vector<Triplet>> qrows_entries;
   std::vector<std::pair<HighsInt, double>> coeffobj;
@@ -186,13 +212,41 @@ class HMpsFF {
   std::vector<ConeType> cone_type;
   std::vector<double> cone_param;
   std::vector<std::vector<HighsInt>> cone_entries;
-  std::unordered_map<std::string, int> rowname2idx;
-  std::unordered_map<std::string, int> colname2idx;
+  HighsHashTable<std::string, HighsInt> rowname2idx;
+  HighsHashTable<std::string, HighsInt> colname2idx;
 
   mutable std::string section_args;
 
+  // State when parsing the COLUMNS section: the current column name and the
+  // integrality marker, together with the scattered values, indices and
+  // count of the nonzeros in the current column, and its cost
+  struct ColumnsState {
+    std::string colname;
+    bool integral_cols = false;
+    std::vector<double> col_value;
+    std::vector<HighsInt> col_index;
+    HighsInt col_count = 0;
+    double col_cost = 0;
+  };
+
+  // A line of the COLUMNS section as parsed from the memory map. The column
+  // name starts the trimmed line. Lines with the usual one or two nonzeros
+  // in known rows have num_entry set to 1 or 2; all other lines have
+  // num_entry = -1 and are parsed as text by parseColumnsLine
+  struct ColumnsLine {
+    const char* begin;
+    HighsInt length;
+    HighsInt name_length;
+    HighsInt num_entry;
+    HighsInt row[2];
+    double value[2];
+  };
+
   FreeFormatParserReturnCode parse(const HighsLogOptions& log_options,
                                    const std::string& filename);
+  FreeFormatParserReturnCode parseSections(const HighsLogOptions& log_options,
+                                           std::istream& file,
+                                           HMpsFileMap* file_map);
   // Checks first word of strline and wraps it by it_begin and it_end
   HMpsFF::Parsekey checkFirstWord(std::string& strline, HighsInt& start,
                                   HighsInt& end, std::string& word) const;
@@ -209,6 +263,24 @@ class HMpsFF {
                              std::istream& file);
   HMpsFF::Parsekey parseCols(const HighsLogOptions& log_options,
                              std::istream& file);
+  HMpsFF::Parsekey parseColsMapped(const HighsLogOptions& log_options,
+                                   HMpsFileMap& file_map);
+  // Parses a data line of the COLUMNS section, where word and end are set by
+  // checkFirstWord. Returns Parsekey::kNone unless parsing has to stop.
+  HMpsFF::Parsekey parseColumnsLine(const HighsLogOptions& log_options,
+                                    std::string& strline, HighsInt end,
+                                    const std::string& word,
+                                    ColumnsState& state);
+  // Parses the COLUMNS data lines in [begin, end) of the memory map without
+  // modifying the parser, returning the number of distinct consecutive
+  // column names
+  HighsInt parseColumnsChunk(const char* begin, const char* end,
+                             std::vector<ColumnsLine>& lines) const;
+  void startColumn(ColumnsState& state, const std::string& colname);
+  void finishColumn(ColumnsState& state);
+  void addColumnEntry(const HighsLogOptions& log_options, ColumnsState& state,
+                      const HighsInt rowidx, const double value,
+                      const std::string& rowname);
   HMpsFF::Parsekey parseRhs(const HighsLogOptions& log_options,
                             std::istream& file);
   HMpsFF::Parsekey parseRanges(const HighsLogOptions& log_options,
@@ -16,6 +16,7 @@
  */
 #include "ipm/IpxWrapper.h"
 
+#include <algorithm>
 #include <cassert>
 
 #include "lp_data/HighsOptions.h"
@@ -26,7 +27,8 @@ using std::min;
 HighsStatus solveLpIpx(HighsLpSolverObject& solver_object) {
   return solveLpIpx(solver_object.options_, solver_object.timer_, solver_object.lp_, 
                     solver_object.basis_, solver_object.solution_, 
-                    solver_object.model_status_, solver_object.highs_info_);
+                    solver_object.model_status_, solver_object.highs_info_,
+                    solver_object.interrupt_flag_, solver_object.callback_);
 }
 
 HighsStatus solveLpIpx(const HighsOptions& options,
@@ -35,7 +37,9 @@ HighsStatus solveLpIpx(const HighsOptions& options,
                        HighsBasis& highs_basis,
 		       HighsSolution& highs_solution,
                        HighsModelStatus& model_status,
-                       HighsInfo& highs_info) {
+                       HighsInfo& highs_info,
+                       const std::atomic<bool>* interrupt_flag,
+                       HighsCallback* callback) {
   // Use IPX to try to solve the LP
   //
   // Can return HighsModelStatus (HighsStatus) values:
@@ -100,7 +104,17 @@ HighsStatus solveLpIpx(const HighsOptions& options,
   parameters.analyse_basis_data = kHighsAnalysisLevelNlaData & options.highs_analysis_level;
   // Determine the run time allowed for IPX
   parameters.time_limit = options.time_limit - timer.readRunHighsClock();
+  // Determine the work allowed for IPX, in its own operation counts
+  if (options.work_limit < kHighsInf)
+    parameters.work_limit =
+        std::max(options.work_limit - highs_info.work_units, 0.0) /
+        kHighsWorkUnitsPerTick;
   parameters.ipm_maxiter = options.ipm_iteration_limit - highs_info.ipm_iteration_count;
+  // Use the task scheduler for matrix-vector products and
+  // preconditioning if the parallel option is on. This doesn't change
+  // the sequence of IPX iterates
+  parameters.parallel = options.parallel == kHighsOnString;
+  parameters.kkt_solver = options.ipm_kkt_solver;
   // Determine if crossover is to be run or not
   parameters.crossover = options.run_crossover;
   if (!parameters.crossover) {
@@ -112,6 +126,22 @@ HighsStatus solveLpIpx(const HighsOptions& options,
 
   // Set the internal IPX parameters
   lps.SetParameters(parameters);
+  lps.SetInterruptFlag(interrupt_flag);
+  // Pass any user callback for IPM iterations, recording whether the
+  // user interrupts so that the time limit status reported by IPX can
+  // be distinguished
+  bool user_interrupt = false;
+  if (callback && callback->callbackActive(kCallbackIpmIteration)) {
+    const HighsInt ipm_iteration_count = highs_info.ipm_iteration_count;
+    lps.SetIterationCallback([&](ipx::Int iter) {
+      callback->clearHighsCallbackDataOut();
+      callback->data_out.running_time = timer.readRunHighsClock();
+      callback->data_out.ipm_iteration_count = ipm_iteration_count + iter;
+      user_interrupt =
+          callback->callbackAction(kCallbackIpmIteration, "IPM iteration");
+      return user_interrupt;
+    });
+  }
 
   ipx::Int num_col, num_row;
   std::vector<ipx::Int> Ap, Ai;
@@ -143,6 +173,7 @@ HighsStatus solveLpIpx(const HighsOptions& options,
   if (report_solve_data) reportSolveData(options.log_options, ipx_info);
   highs_info.ipm_iteration_count += (HighsInt)ipx_info.iter;
   highs_info.crossover_iteration_count += (HighsInt)ipx_info.updates_crossover;
+  highs_info.work_units += kHighsWorkUnitsPerTick * ipx_info.work;
 
   // If not solved...
   if (solve_status != IPX_STATUS_solved) {
@@ -214,7 +245,8 @@ HighsStatus solveLpIpx(const HighsOptions& options,
     // Can stop with iter limit
     // Can stop with no progress
     if (ipx_info.status_ipm == IPX_STATUS_time_limit) {
-      model_status = HighsModelStatus::kTimeLimit;
+      model_status = user_interrupt ? HighsModelStatus::kInterrupt
+                                    : HighsModelStatus::kTimeLimit;
       return HighsStatus::kWarning;
     } else if (ipx_info.status_ipm == IPX_STATUS_iter_limit) {
       model_status = HighsModelStatus::kIterationLimit;
@@ -22,6 +22,7 @@
 #include "ipm/IpxSolution.h"
 #include "ipm/ipx/include/ipx_status.h"
 #include "ipm/ipx/src/lp_solver.h"
+#include "lp_data/HighsCallback.h"
 #include "lp_data/HighsSolution.h"
 
 HighsStatus solveLpIpx(HighsLpSolverObject& solver_object);
@@ -29,7 +30,9 @@ HighsStatus solveLpIpx(HighsLpSolverObject& solver_object);
 HighsStatus solveLpIpx(const HighsOptions& options, HighsTimer& timer,
                        const HighsLp& lp, HighsBasis& highs_basis,
                        HighsSolution& highs_solution,
-                       HighsModelStatus& model_status, HighsInfo& highs_info);
+                       HighsModelStatus& model_status, HighsInfo& highs_info,
+                       const std::atomic<bool>* interrupt_flag = nullptr,
+                       HighsCallback* callback = nullptr);
 
 void fillInIpxData(const HighsLp& lp, ipx::Int& num_col, ipx::Int& num_row,
                    std::vector<double>& obj, std::vector<double>& col_lb,
@@ -59,6 +59,7 @@ struct ipx_info {
     ipxint updates_start;       /* # basis updates for starting basis */
     ipxint updates_ipm;         /* # basis updates in IPM */
     ipxint updates_crossover;   /* # basis updates in crossover */
+    double work;                /* deterministic work measure */
 
     /* major computation times */
     double time_total;          /* total runtime (wallclock) */
@@ -12,6 +12,7 @@ struct ipx_parameters {
     const char* logfile;
     double print_interval;
     double time_limit;
+    double work_limit;
     bool analyse_basis_data;
 
     /* Preprocessing */
@@ -27,6 +28,8 @@ struct ipx_parameters {
 
     /* Linear solver */
     double kkt_tol;
+    ipxint parallel;
+    ipxint kkt_solver;
 
     /* Basis construction in IPM */
     ipxint crash_basis;
@@ -14,6 +14,17 @@ Int Control::InterruptCheck() const {
     if (parameters_.time_limit >= 0.0 &&
         parameters_.time_limit < timer_.Elapsed())
         return IPX_ERROR_interrupt_time;
+    work_ += work_per_check_;
+    if (parameters_.work_limit >= 0.0 && parameters_.work_limit < work_)
+        return IPX_ERROR_interrupt_time;
+    if (interrupt_flag_ && interrupt_flag_->load(std::memory_order_relaxed))
+        return IPX_ERROR_interrupt_time;
+    return 0;
+}
+
+Int Control::IterationCallback(Int iter) const {
+    if (iteration_callback_ && iteration_callback_(iter))
+        return IPX_ERROR_interrupt_time;
     return 0;
 }
 
@@ -70,6 +81,7 @@ void Control::CloseLogfile() {
 
 void Control::ResetTimer() {
     timer_.Reset();
+    work_ = 0.0;
 }
 
 void Control::MakeStream() {
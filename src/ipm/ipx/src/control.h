@@ -1,7 +1,9 @@
 #ifndef IPX_CONTROL_H_
 #define IPX_CONTROL_H_
 
+#include <atomic>
 #include <fstream>
+#include <functional>
 #include <ostream>
 #include <sstream>
 #include <string>
@@ -15,13 +17,14 @@ namespace ipx {
 // (1) accessing user parameters,
 // (2) solver output,
 // (3) solver interruption.
-// Currently the solver is interrupted only by time limit. The interrupt
-// mechanism could also be used if we run IPX and a simplex code concurrently
-// and want to interrupt IPX when the simplex finished. For that reason a
-// Control object cannot be copied; assuming that one thread sets an interrupt
-// signal (not implemented yet), a call to control.InterruptCheck() from any
-// part of the solver must return nonzero. Hence we must only have references or
-// pointers to a single Control object in the whole of IPX.
+// The solver is interrupted by time limit, by work limit or by an interrupt
+// flag. The flag is used if we run IPX and a simplex code concurrently and
+// want to interrupt IPX when the simplex finished. For that reason a Control
+// object cannot be copied; assuming that one thread sets the interrupt flag, a
+// call to control.InterruptCheck() from any part of the solver must return
+// nonzero.
+// Hence we must only have references or pointers to a single Control object
+// in the whole of IPX.
 
 class Control {
 public:
@@ -35,9 +38,34 @@ public:
     Control& operator=(Control&&) = delete;
     Control(const Control&&) = delete;
 
-    // Returns IPX_ERROR_* if interrupt is requested, 0 otherwise.
+    // Returns IPX_ERROR_* if interrupt is requested, 0 otherwise. Each call
+    // charges work_per_check() to the work counter. An interrupt by work
+    // limit is reported as interrupt by time limit.
     Int InterruptCheck() const;
 
+    // The work charged per InterruptCheck() is a deterministic estimate of
+    // the cost of one step of the solver (a linear operator application or
+    // a basis update) between two checks. Work() returns the total since
+    // the last call to ResetTimer().
+    void work_per_check(double work) { work_per_check_ = work; }
+    double Work() const { return work_; }
+
+    // Sets a flag that may be raised by another thread to interrupt the
+    // solver. An interrupt by flag is reported as interrupt by time limit.
+    void interrupt_flag(const std::atomic<bool>* flag) {
+        interrupt_flag_ = flag; }
+
+    // Calls the iteration callback, if any, after IPM iteration @iter.
+    // Returns IPX_ERROR_interrupt_time if the callback requests an
+    // interrupt, 0 otherwise. An interrupt by callback is reported as
+    // interrupt by time limit.
+    Int IterationCallback(Int iter) const;
+
+    // Sets a function that is called once per IPM iteration with the
+    // iteration count and returns true to interrupt the solver.
+    void iteration_callback(std::function<bool(Int)> callback) {
+        iteration_callback_ = callback; }
+
     // Returns output streams for log and debugging messages. The streams
     // evaluate to false if they discard output, so that we can write
     //
@@ -65,6 +93,8 @@ public:
     double ipm_drop_primal() const { return parameters_.ipm_drop_primal; }
     double ipm_drop_dual() const { return parameters_.ipm_drop_dual; }
     double kkt_tol() const { return parameters_.kkt_tol; }
+    ipxint parallel() const { return parameters_.parallel; }
+    ipxint kkt_solver() const { return parameters_.kkt_solver; }
     ipxint crash_basis() const { return parameters_.crash_basis; }
     double dependency_tol() const { return parameters_.dependency_tol; }
     double volume_tol() const { return parameters_.volume_tol; }
@@ -92,12 +122,16 @@ public:
     // Closes an opened log file, if any.
     void CloseLogfile();
 
-    // Resets the total runtime counter.
+    // Resets the total runtime and work counters.
     void ResetTimer();
 
 private:
     void MakeStream();           // composes output_
     Parameters parameters_;
+    const std::atomic<bool>* interrupt_flag_{nullptr};
+    std::function<bool(Int)> iteration_callback_;
+    double work_per_check_{1.0};
+    mutable double work_{0.0};
     std::ofstream logfile_;
     Timer timer_;                // total runtime
     mutable Timer interval_;     // time since last interval log
@@ -4,11 +4,16 @@
 #include <cassert>
 #include <cmath>
 #include <vector>
+#include "parallel/HighsParallel.h"
 #include "timer.h"
 
 namespace ipx {
 
-DiagonalPrecond::DiagonalPrecond(const Model& model) : model_(model) {
+// Number of rows processed by one task in parallel mode
+static const Int kParallelGrainSize = 1024;
+
+DiagonalPrecond::DiagonalPrecond(const Model& model, bool parallel) :
+    model_(model), parallel_(parallel) {
     const Int m = model_.rows();
     diagonal_.resize(m);
 }
@@ -21,7 +26,23 @@ void DiagonalPrecond::Factorize(const double* W, Info* info) {
     factorized_ = false;
 
     // Build diagonal of normal matrix.
-    if (W) {
+    if (parallel_) {
+        // Sum over the rows of AIt. Since they are sorted by column index,
+        // each diagonal entry is summed in the same order as below.
+        const SparseMatrix& AIt = model_.AIt();
+        highs::parallel::for_each(0, m, [&](Int first, Int last) {
+            for (Int i = first; i < last; i++) {
+                // skip identity entry
+                Int begin = AIt.begin(i), end = AIt.end(i)-1;
+                double d = W ? W[n+i] : 0.0;
+                for (Int p = begin; p < end; p++) {
+                    double w = W ? W[AIt.index(p)] : 1.0;
+                    d += AIt.value(p) * w * AIt.value(p);
+                }
+                diagonal_[i] = d;
+            }
+        }, kParallelGrainSize);
+    } else if (W) {
         for (Int i = 0; i < m; i++)
             diagonal_[i] = W[n+i];
         for (Int j = 0; j < n; j++) {
@@ -58,9 +79,20 @@ void DiagonalPrecond::_Apply(const Vector& rhs, Vector& lhs,
     assert(lhs.size() == m);
     assert(rhs.size() == m);
 
-    for (Int i = 0; i < m; i++) {
-        lhs[i] = rhs[i] / diagonal_[i];
-        rldot += lhs[i] * rhs[i];
+    if (parallel_) {
+        // Only the division is done by tasks, so that rldot is summed in
+        // the same order as in serial.
+        highs::parallel::for_each(0, m, [&](Int first, Int last) {
+            for (Int i = first; i < last; i++)
+                lhs[i] = rhs[i] / diagonal_[i];
+        }, kParallelGrainSize);
+        for (Int i = 0; i < m; i++)
+            rldot += lhs[i] * rhs[i];
+    } else {
+        for (Int i = 0; i < m; i++) {
+            lhs[i] = rhs[i] / diagonal_[i];
+            rldot += lhs[i] * rhs[i];
+        }
     }
     if (rhs_dot_lhs)
         *rhs_dot_lhs = rldot;
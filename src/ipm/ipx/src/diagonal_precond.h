@@ -19,8 +19,10 @@ namespace ipx {
 class DiagonalPrecond : public LinearOperator {
 public:
     // Constructor stores a reference to the model. No data is copied. The model
-    // must be valid as long as the preconditioner is used.
-    explicit DiagonalPrecond(const Model& model);
+    // must be valid as long as the preconditioner is used. If @parallel is
+    // true, then the diagonal is built and applied by the HiGHS task
+    // scheduler. The result is identical to that of the serial computation.
+    explicit DiagonalPrecond(const Model& model, bool parallel = false);
 
     // Factorizes the preconditioner. W must either hold n+m entries, or be
     // NULL, in which case the first n entries are assumed 1.0 and the last
@@ -35,6 +37,7 @@ private:
     void _Apply(const Vector& rhs, Vector& lhs, double* rhs_dot_lhs) override;
 
     const Model& model_;
+    bool parallel_{false};      // use HiGHS task scheduler?
     bool factorized_{false};    // preconditioner factorized?
     Vector diagonal_;           // diagonal of normal matrix
     double time_{0.0};
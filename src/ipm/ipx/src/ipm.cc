@@ -76,6 +76,8 @@ void IPM::Driver(KKTSolver* kkt, Iterate* iterate, Info* info) {
         MakeStep(step);
         info->iter++;
         PrintOutput();
+        if ((info->errflag = control_.IterationCallback(info->iter)) != 0)
+            break;
     }
 
     // Set status_ipm if errflag terminated IPM.
@@ -10,6 +10,7 @@ struct ipx_parameters ipx_default_parameters() {
     p.logfile = nullptr;
     p.print_interval = 5.0;
     p.time_limit = -1.0;
+    p.work_limit = -1.0;
     p.analyse_basis_data = false;
     p.dualize = -1;
     p.scale = 1;
@@ -19,6 +20,8 @@ struct ipx_parameters ipx_default_parameters() {
     p.ipm_drop_primal = 1e-9;
     p.ipm_drop_dual = 1e-9;
     p.kkt_tol = 0.3;
+    p.parallel = 0;
+    p.kkt_solver = 0;
     p.crash_basis = 1;
     p.dependency_tol = 1e-6;
     p.volume_tol = 2.0;
@@ -24,6 +24,7 @@ struct Parameters : public ipx_parameters {
     print_interval = 5.0;
     analyse_basis_data = false;
     time_limit = -1.0;
+    work_limit = -1.0;
     dualize = -1;
     scale = 1;
     ipm_maxiter = 300;
@@ -32,6 +33,8 @@ struct Parameters : public ipx_parameters {
     ipm_drop_primal = 1e-9;
     ipm_drop_dual = 1e-9;
     kkt_tol = 0.3;
+    parallel = 0;
+    kkt_solver = 0;
     crash_basis = 1;
     dependency_tol = 1e-6;
     volume_tol = 2.0;
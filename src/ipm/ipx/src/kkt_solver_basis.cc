@@ -9,7 +9,7 @@ namespace ipx {
 
 KKTSolverBasis::KKTSolverBasis(const Control& control, Basis& basis)
     : control_(control), model_(basis.model()), basis_(basis),
-      splitted_normal_matrix_(model_) {
+      splitted_normal_matrix_(model_, control.parallel()) {
     const Int m = model_.rows();
     const Int n = model_.cols();
     colscale_.resize(n+m);
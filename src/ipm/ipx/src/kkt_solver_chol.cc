@@ -0,0 +1,160 @@
+#include "kkt_solver_chol.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iterator>
+#include "conjugate_residuals.h"
+#include "timer.h"
+
+namespace ipx {
+
+// A column of A is dense if it has more than max(kDenseColumnMinCount,
+// kDenseColumnFactor * average column count) entries. At most
+// kMaxDenseColumns columns (those with the most entries) are treated as dense,
+// since each dense column can cost one more CR iteration.
+static constexpr Int kDenseColumnMinCount = 40;
+static constexpr double kDenseColumnFactor = 10.0;
+static constexpr Int kMaxDenseColumns = 100;
+
+// The CR method is stopped after kMaxRefinementSteps iterations plus one per
+// dense column. Since the preconditioner is exact up to round-off and dense
+// columns, the solution is then as accurate as the factorization permits.
+static constexpr Int kMaxRefinementSteps = 10;
+
+KKTSolverChol::KKTSolverChol(const Control& control, const Model& model) :
+    control_(control), model_(model),
+    normal_matrix_(model, control.parallel()) {
+    const Int m = model_.rows();
+    const Int n = model_.cols();
+    const SparseMatrix& AI = model_.AI();
+    W_.resize(m+n);
+    resscale_.resize(m);
+
+    // Find dense columns.
+    const double average = n > 0 ? (double) AI.begin(n) / n : 0.0;
+    const double threshold = std::max((double) kDenseColumnMinCount,
+                                      kDenseColumnFactor * average);
+    std::vector<Int> dense_cols;
+    for (Int j = 0; j < n; j++)
+        if (AI.end(j)-AI.begin(j) > threshold)
+            dense_cols.push_back(j);
+    if ((Int) dense_cols.size() > kMaxDenseColumns) {
+        std::nth_element(dense_cols.begin(),
+                         dense_cols.begin() + kMaxDenseColumns,
+                         dense_cols.end(), [&AI](Int j1, Int j2) {
+                             return AI.end(j1)-AI.begin(j1) >
+                                 AI.end(j2)-AI.begin(j2); });
+        dense_cols.resize(kMaxDenseColumns);
+    }
+    std::vector<bool> is_dense(n, false);
+    for (Int j : dense_cols)
+        is_dense[j] = true;
+    for (Int j = 0; j < n; j++)
+        if (!is_dense[j])
+            sparse_cols_.push_back(j);
+    colweight_.resize(sparse_cols_.size());
+    maxiter_ = kMaxRefinementSteps + dense_cols.size();
+
+    // Ordering and symbolic factorization.
+    Timer timer;
+    cholesky_.Analyse(CopyColumns(AI, sparse_cols_));
+    control_.Log()
+        << " Cholesky factor of normal matrix: "
+        << cholesky_.nnz() << " nonzeros, "
+        << cholesky_.supernodes() << " supernodes, "
+        << dense_cols.size() << " dense columns ("
+        << fix2(timer.Elapsed()) << "s)\n";
+}
+
+void KKTSolverChol::_Factorize(Iterate* pt, Info* info) {
+    const Int m = model_.rows();
+    const Int n = model_.cols();
+    iter_ = 0;
+    factorized_ = false;
+
+    // Build matrix W for AI*W*AI' as in KKTSolverDiag.
+    if (pt) {
+        const Vector& xl = pt->xl();
+        const Vector& xu = pt->xu();
+        const Vector& zl = pt->zl();
+        const Vector& zu = pt->zu();
+        double regval = pt->mu();
+        for (Int j = 0; j < n+m; j++) {
+            assert(xl[j] > 0.0);
+            assert(xu[j] > 0.0);
+            double g = zl[j]/xl[j] + zu[j]/xu[j];
+            assert(std::isfinite(g));
+            if (g != 0.0 && g < regval)
+                regval = g;
+            W_[j] = 1.0 / g;        // infinity if g is zero
+        }
+        for (Int j = 0; j < n+m; j++) {
+            if (std::isinf(W_[j]))
+                W_[j] = 1.0 / regval;
+            assert(std::isfinite(W_[j]));
+            assert(W_[j] > 0.0);
+        }
+    } else {
+        W_ = 1.0;
+    }
+
+    // Residual scaling factors for termination test of CR method.
+    for (Int i = 0; i < m; i++)
+        resscale_[i] = 1.0 / std::sqrt(W_[n+i]);
+
+    for (Int k = 0; k < (Int) sparse_cols_.size(); k++)
+        colweight_[k] = W_[sparse_cols_[k]];
+    Int num_replaced = cholesky_.Factorize(std::begin(colweight_),
+                                           std::begin(W_) + n);
+    control_.Debug(3)
+        << " Cholesky factorization replaced " << num_replaced << " pivots\n";
+    normal_matrix_.Prepare(&W_[0]);
+    factorized_ = true;
+}
+
+// Reduces the KKT system to normal equations as in KKTSolverDiag and solves
+// them by the CR method preconditioned with the Cholesky factorization.
+void KKTSolverChol::_Solve(const Vector& a, const Vector& b, double tol,
+                           Vector& x, Vector& y, Info* info) {
+    const Int m = model_.rows();
+    const Int n = model_.cols();
+    const SparseMatrix& AI = model_.AI();
+    assert(factorized_);
+
+    // Compose right-hand side AI*W*a-b.
+    Vector rhs = -b;
+    for (Int j = 0; j < n+m; j++)
+        ScatterColumn(AI, j, W_[j]*a[j], rhs);
+
+    // Solve normal equations.
+    y = 0.0;
+    normal_matrix_.reset_time();
+    cholesky_.reset_time();
+    ConjugateResiduals cr(control_);
+    cr.Solve(normal_matrix_, cholesky_, rhs, tol, &resscale_[0], maxiter_, y);
+    info->errflag = cr.errflag();
+    // If round-off errors prevent the CR method from reaching the tolerance,
+    // the solution from the factorization is accepted.
+    if (info->errflag == IPX_ERROR_cr_iter_limit ||
+        info->errflag == IPX_ERROR_cr_no_progress)
+        info->errflag = 0;
+    info->kktiter1 += cr.iter();
+    info->time_cr1 += cr.time();
+    info->time_cr1_AAt += normal_matrix_.time();
+    info->time_cr1_pre += cholesky_.time();
+    iter_ += cr.iter();
+
+    // Recover solution to KKT system.
+    for (Int i = 0; i < m; i++)
+        x[n+i] = b[i];
+    for (Int j = 0; j < n; j++) {
+        double aty = DotColumn(AI, j, y);
+        x[j] = W_[j] * (a[j]-aty);
+        for (Int p = AI.begin(j); p < AI.end(j); p++) {
+            Int i = AI.index(p);
+            x[n+i] -= x[j] * AI.value(p);
+        }
+    }
+}
+
+}  // namespace ipx
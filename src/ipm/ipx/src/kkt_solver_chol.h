@@ -0,0 +1,54 @@
+#ifndef IPX_KKT_SOLVER_CHOL_H_
+#define IPX_KKT_SOLVER_CHOL_H_
+
+#include <vector>
+#include "control.h"
+#include "kkt_solver.h"
+#include "model.h"
+#include "normal_matrix.h"
+#include "sparse_cholesky.h"
+
+namespace ipx {
+
+// KKTSolverChol implements a direct KKT solver that factorizes the normal
+// matrix AI*W*AI' by a supernodal sparse Cholesky factorization. The ordering
+// and symbolic factorization are computed once in the constructor and reused
+// in each call to Factorize().
+//
+// Columns of A that have many more entries than average ("dense columns") are
+// left out of the factorization, since they would make the normal matrix
+// dense. The Cholesky factor of the remaining part is then used to
+// precondition the Conjugate Residuals method on the full normal equations.
+// Without dense columns the CR method serves as iterative refinement and
+// typically terminates after one iteration.
+//
+// In the call to Factorize() @iterate is allowed to be NULL, in which case the
+// (1,1) block of the KKT matrix is the identity matrix.
+
+class KKTSolverChol : public KKTSolver {
+public:
+    KKTSolverChol(const Control& control, const Model& model);
+
+private:
+    void _Factorize(Iterate* iterate, Info* info) override;
+    void _Solve(const Vector& a, const Vector& b, double tol,
+                Vector& x, Vector& y, Info* info) override;
+    Int _iter() const override { return iter_; };
+
+    const Control& control_;
+    const Model& model_;
+    NormalMatrix normal_matrix_;
+    SparseCholesky cholesky_;
+
+    std::vector<Int> sparse_cols_; // columns of A in Cholesky factorization
+    Vector W_;               // diagonal matrix in AI*W*AI'
+    Vector colweight_;       // entries of W for sparse_cols_
+    Vector resscale_;        // residual scaling factors for CR termination test
+    bool factorized_{false}; // KKT matrix factorized?
+    Int maxiter_{0};         // max # CR iterations per Solve()
+    Int iter_{0};            // # CR iterations since last Factorize()
+};
+
+}  // namespace ipx
+
+#endif  // IPX_KKT_SOLVER_CHOL_H_
@@ -8,7 +8,9 @@
 namespace ipx {
 
 KKTSolverDiag::KKTSolverDiag(const Control& control, const Model& model) :
-    control_(control), model_(model), normal_matrix_(model), precond_(model) {
+    control_(control), model_(model),
+    normal_matrix_(model, control.parallel()),
+    precond_(model, control.parallel()) {
     Int m = model_.rows();
     Int n = model_.cols();
     W_.resize(m+n);
@@ -6,6 +6,7 @@
 #include "crossover.h"
 #include "info.h"
 #include "kkt_solver_basis.h"
+#include "kkt_solver_chol.h"
 #include "kkt_solver_diag.h"
 #include "starting_basis.h"
 #include "utils.h"
@@ -20,6 +21,7 @@ Int LpSolver::LoadModel(Int num_var, const double* obj, const double* lb,
     Int errflag = model_.Load(control_, num_constr, num_var, Ap, Ai, Ax, rhs,
                               constr_type, obj, lb, ub);
     model_.GetInfo(&info_);
+    control_.work_per_check(info_.num_rows_solver + info_.num_entries_solver);
     return errflag;
 }
 
@@ -100,6 +102,7 @@ Int LpSolver::Solve() {
         info_.status = IPX_STATUS_internal_error;
     }
     info_.time_total = control_.Elapsed();
+    info_.work = control_.Work();
     control_.Debug(2) << info_;
     control_.CloseLogfile();
     if (control_.reportBasisData())
@@ -141,6 +144,14 @@ void LpSolver::SetParameters(Parameters new_parameters) {
     control_.parameters(new_parameters);
 }
 
+void LpSolver::SetInterruptFlag(const std::atomic<bool>* flag) {
+    control_.interrupt_flag(flag);
+}
+
+void LpSolver::SetIterationCallback(std::function<bool(Int)> callback) {
+    control_.iteration_callback(callback);
+}
+
 void LpSolver::ClearModel() {
     model_.clear();
     ClearSolution();
@@ -370,7 +381,14 @@ void LpSolver::RunIPM() {
         ComputeStartingPoint(ipm);
         if (info_.status_ipm != IPX_STATUS_not_run)
             return;
-        RunInitialIPM(ipm);
+        if (control_.kkt_solver() == 0) {
+            RunInitialIPM(ipm);
+            if (info_.status_ipm != IPX_STATUS_not_run)
+                return;
+        }
+    }
+    if (control_.kkt_solver() != 0) {
+        RunCholeskyIPM(ipm);
         if (info_.status_ipm != IPX_STATUS_not_run)
             return;
     }
@@ -526,6 +544,38 @@ void LpSolver::RunMainIPM(IPM& ipm) {
     info_.time_ipm2 = timer.Elapsed();
 }
 
+void LpSolver::RunCholeskyIPM(IPM& ipm) {
+    Timer timer;
+    KKTSolverChol kkt(control_, model_);
+    // Without a basis, the IPM cannot fix converged variables and usually
+    // stagnates before the residuals from dropping to complementarity are
+    // below crossover_start. Hence terminate the IPM on the IPM tolerances.
+    const double crossover_start = iterate_->crossover_start();
+    iterate_->crossover_start(0.0);
+    ipm.maxiter(control_.ipm_maxiter());
+    ipm.Driver(&kkt, iterate_.get(), &info_);
+    iterate_->crossover_start(crossover_start);
+    info_.time_ipm1 += timer.Elapsed();
+    switch (info_.status_ipm) {
+    case IPX_STATUS_optimal:
+        // Crossover requires a basis, which is constructed from the final
+        // iterate.
+        if (control_.crossover())
+            BuildStartingBasis();
+        break;
+    case IPX_STATUS_no_progress:
+        // Round-off errors in the normal equations prevent further progress
+        // close to the optimum. As after the initial IPM, construct a basis
+        // and continue with basis preconditioning.
+        info_.status_ipm = IPX_STATUS_not_run;
+        break;
+    case IPX_STATUS_failed:
+        info_.status_ipm = IPX_STATUS_not_run;
+        info_.errflag = 0;
+        break;
+    }
+}
+
 void LpSolver::BuildCrossoverStartingPoint() {
     const Int m = model_.rows();
     const Int n = model_.cols();
@@ -98,6 +98,15 @@ public:
     Parameters GetParameters() const;
     void SetParameters(Parameters new_parameters);
 
+    // Sets a flag that, once raised by another thread, interrupts the solver
+    // as if the time limit was reached. NULL means no interrupt flag.
+    void SetInterruptFlag(const std::atomic<bool>* flag);
+
+    // Sets a function that is called after each IPM iteration with the
+    // iteration count. If it returns true, the solver is interrupted as if
+    // the time limit was reached.
+    void SetIterationCallback(std::function<bool(Int)> callback);
+
     // Discards the model and solution (if any) but keeps the parameters.
     void ClearModel();
 
@@ -168,6 +177,7 @@ private:
     void RunInitialIPM(IPM& ipm);
     void BuildStartingBasis();
     void RunMainIPM(IPM& ipm);
+    void RunCholeskyIPM(IPM& ipm);
     void BuildCrossoverStartingPoint();
     void RunCrossover();
     void PrintSummary();
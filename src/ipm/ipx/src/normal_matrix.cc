@@ -1,5 +1,6 @@
 #include "normal_matrix.h"
 #include <cassert>
+#include "parallel/HighsParallel.h"
 #include "timer.h"
 #include "utils.h"
 
@@ -17,13 +18,26 @@ namespace ipx {
 // is the fastest on average (about 20% better than the best two-pass variant),
 // and also the fastest on most LP models. Therefore, it is used for
 // matrix-vector products of the form AA' here and in SplittedNormalMatrix.
+//
+// When the object is constructed as parallel, then method 2 is used with the
+// column pass and the row pass split into blocks that are processed as tasks.
+// Since the rows of AIt are sorted by column index, each lhs[i] is summed in
+// the same order as in method 1. Hence the result is bit-for-bit identical to
+// the serial result, independent of the number of threads.
 #define MATVECMETHOD 1
 
-NormalMatrix::NormalMatrix(const Model& model) : model_(model) {
+// Number of columns or rows of AI processed by one task
+static const Int kParallelGrainSize = 1024;
+
+NormalMatrix::NormalMatrix(const Model& model, bool parallel) :
+    model_(model), parallel_(parallel) {
     #if MATVECMETHOD > 1
     // The two-pass variants require n+m workspace to store the intermediate
     // result W*AI'*rhs.
     work_.resize(model.rows() + model.cols());
+    #else
+    if (parallel_)
+        work_.resize(model.rows() + model.cols());
     #endif
 }
 
@@ -58,7 +72,33 @@ void NormalMatrix::_Apply(const Vector& rhs, Vector& lhs,
     assert(lhs.size() == m);
     assert(rhs.size() == m);
 
-    if (W_) {
+    if (parallel_) {
+        const Int* Atp = model_.AIt().colptr();
+        const Int* Ati = model_.AIt().rowidx();
+        const double* Atx = model_.AIt().values();
+        const double* W = W_;
+        double* work = &work_[0];
+        highs::parallel::for_each(0, n, [&](Int first, Int last) {
+            for (Int j = first; j < last; j++) {
+                Int begin = Ap[j], end = Ap[j+1];
+                double d = 0.0;
+                for (Int p = begin; p < end; p++)
+                    d += rhs[Ai[p]] * Ax[p];
+                if (W)
+                    d *= W[j];
+                work[j] = d;
+            }
+        }, kParallelGrainSize);
+        highs::parallel::for_each(0, m, [&](Int first, Int last) {
+            for (Int i = first; i < last; i++) {
+                Int begin = Atp[i], end = Atp[i+1]-1; // skip identity entry
+                double d = W ? rhs[i] * W[n+i] : 0.0;
+                for (Int p = begin; p < end; p++)
+                    d += work[Ati[p]] * Atx[p];
+                lhs[i] = d;
+            }
+        }, kParallelGrainSize);
+    } else if (W_) {
         #if MATVECMETHOD == 1
         for (Int i = 0; i < m; i++)
             lhs[i] = rhs[i] * W_[n+i];
@@ -16,8 +16,10 @@ namespace ipx {
 class NormalMatrix : public LinearOperator {
 public:
     // Constructor stores a reference to the model. No data is copied. The model
-    // must be valid as long as the object is used.
-    explicit NormalMatrix(const Model& model);
+    // must be valid as long as the object is used. If @parallel is true, then
+    // matrix-vector products are computed by the HiGHS task scheduler. The
+    // result is identical to that of the serial computation.
+    explicit NormalMatrix(const Model& model, bool parallel = false);
 
     // Prepares normal matrix for subsequent calls to Apply(). If W is not NULL,
     // then W must hold n+m entries. No data is copied. The array must be valid
@@ -34,6 +36,7 @@ private:
 
     const Model& model_;
     const double* W_{nullptr};
+    bool parallel_{false};
     bool prepared_{false};
     Vector work_;            // size n+m workspace (2-pass matvec products only)
     double time_{0.0};
@@ -0,0 +1,433 @@
+#include "sparse_cholesky.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include "timer.h"
+#include "utils.h"
+
+namespace ipx {
+
+// A pivot d is replaced by kHugePivot if d <= kPivotTol * (diagonal entry of
+// the matrix before factorization).
+static constexpr double kPivotTol = 1e-14;
+static constexpr double kHugePivot = 1e128;
+
+// Computes a minimum degree ordering of the symmetric matrix with off-diagonal
+// pattern given by the adjacency lists adj[0..m-1]. The method works on the
+// quotient graph of the elimination, in which eliminated variables become
+// elements (cliques). The degree of a variable is approximated by
+//
+//   |variable neighbours| + |Lp\i| + sum_{e adjacent to i, e != p} |Le\Lp|,
+//
+// where p is the pivot just eliminated and Lp its element. This is the bound
+// used in approximate minimum degree; supervariables are not detected.
+static std::vector<Int> MinimumDegree(std::vector<std::vector<Int>>& adj) {
+    const Int m = adj.size();
+    std::vector<std::vector<Int>>& vars = adj; // vars of variable or element
+    std::vector<std::vector<Int>> elems(m);    // elements of variable
+    std::vector<bool> eliminated(m, false), absorbed(m, false);
+    std::vector<Int> degree(m), head(m+1, -1), next(m, -1), prev(m, -1);
+    std::vector<Int> mark(m, -1), wflag(m, -1), wval(m, 0);
+    std::vector<Int> perm, Lp;
+    perm.reserve(m);
+
+    auto insert = [&](Int i) {
+        Int d = degree[i];
+        next[i] = head[d];
+        prev[i] = -1;
+        if (head[d] >= 0)
+            prev[head[d]] = i;
+        head[d] = i;
+    };
+    auto remove = [&](Int i) {
+        if (prev[i] >= 0)
+            next[prev[i]] = next[i];
+        else
+            head[degree[i]] = next[i];
+        if (next[i] >= 0)
+            prev[next[i]] = prev[i];
+    };
+
+    for (Int i = 0; i < m; i++) {
+        degree[i] = vars[i].size();
+        insert(i);
+    }
+    Int mindeg = 0;
+    for (Int k = 0; k < m; k++) {
+        while (head[mindeg] < 0)
+            mindeg++;
+        const Int p = head[mindeg];
+        remove(p);
+        eliminated[p] = true;
+        perm.push_back(p);
+
+        // Build Lp from the variable neighbours of p and the variables of
+        // elements adjacent to p. The latter elements are absorbed into p.
+        Lp.clear();
+        mark[p] = k;
+        for (Int v : vars[p]) {
+            if (!eliminated[v] && mark[v] != k) {
+                mark[v] = k;
+                Lp.push_back(v);
+            }
+        }
+        for (Int e : elems[p]) {
+            if (absorbed[e])
+                continue;
+            for (Int v : vars[e]) {
+                if (!eliminated[v] && mark[v] != k) {
+                    mark[v] = k;
+                    Lp.push_back(v);
+                }
+            }
+            absorbed[e] = true;
+            std::vector<Int>().swap(vars[e]);
+        }
+        vars[p] = Lp;
+        std::vector<Int>().swap(elems[p]);
+
+        // Update adjacency lists of variables in Lp. Variable neighbours that
+        // are in Lp are now covered by element p.
+        for (Int i : Lp) {
+            remove(i);
+            std::vector<Int>& ei = elems[i];
+            ei.erase(std::remove_if(ei.begin(), ei.end(),
+                                    [&](Int e) { return absorbed[e]; }),
+                     ei.end());
+            ei.push_back(p);
+            std::vector<Int>& vi = vars[i];
+            vi.erase(std::remove_if(vi.begin(), vi.end(), [&](Int v) {
+                        return eliminated[v] || mark[v] == k; }),
+                     vi.end());
+        }
+
+        // Compute wval[e] = |Le\Lp| for elements adjacent to Lp.
+        for (Int i : Lp) {
+            for (Int e : elems[i]) {
+                if (e == p)
+                    continue;
+                if (wflag[e] != k) {
+                    wflag[e] = k;
+                    wval[e] = vars[e].size();
+                }
+                wval[e]--;
+            }
+        }
+
+        // Update approximate degrees.
+        const Int remaining = m-k-1;
+        const Int lpsize = Lp.size();
+        for (Int i : Lp) {
+            Int d = vars[i].size() + lpsize-1;
+            for (Int e : elems[i])
+                if (e != p)
+                    d += wval[e];
+            d = std::min(d, remaining-1);
+            d = std::min(d, degree[i] + lpsize-1);
+            degree[i] = std::max(d, (Int) 0);
+            insert(i);
+            mindeg = std::min(mindeg, degree[i]);
+        }
+    }
+    return perm;
+}
+
+void SparseCholesky::Analyse(const SparseMatrix& A) {
+    const Int m = A.rows();
+    dim_ = m;
+    factorized_ = false;
+    A_ = A;
+    At_ = Transpose(A);
+
+    // Build the off-diagonal pattern of A*A'.
+    std::vector<std::vector<Int>> adj(m);
+    std::vector<Int> mark(m, -1);
+    for (Int i = 0; i < m; i++) {
+        mark[i] = i;
+        for (Int p = At_.begin(i); p < At_.end(i); p++) {
+            Int j = At_.index(p);
+            for (Int q = A_.begin(j); q < A_.end(j); q++) {
+                Int r = A_.index(q);
+                if (mark[r] != i) {
+                    mark[r] = i;
+                    adj[i].push_back(r);
+                }
+            }
+        }
+    }
+
+    // Compute ordering. MinimumDegree() destroys its argument, so it works on
+    // a copy of the adjacency lists. Then build the lower triangular pattern of
+    // the permuted matrix.
+    {
+        std::vector<std::vector<Int>> work(adj);
+        perm_ = MinimumDegree(work);
+    }
+    std::vector<std::vector<Int>> lower(m);
+    iperm_.assign(m, 0);
+    for (Int c = 0; c < m; c++)
+        iperm_[perm_[c]] = c;
+    for (Int i = 0; i < m; i++) {
+        Int c = iperm_[i];
+        for (Int r : adj[i]) {
+            Int cr = iperm_[r];
+            if (cr > c)
+                lower[c].push_back(cr);
+        }
+        std::vector<Int>().swap(adj[i]);
+    }
+
+    // Symbolic factorization. The pattern of column c of L (below the
+    // diagonal) is the union of the pattern of column c of the permuted matrix
+    // and the patterns of its children in the elimination tree, minus c.
+    std::vector<std::vector<Int>> pattern(m);
+    std::vector<std::vector<Int>> children(m);
+    std::vector<Int> parent(m, -1);
+    std::fill(mark.begin(), mark.end(), -1);
+    for (Int c = 0; c < m; c++) {
+        std::vector<Int>& pc = pattern[c];
+        mark[c] = c;
+        for (Int r : lower[c]) {
+            if (mark[r] != c) {
+                mark[r] = c;
+                pc.push_back(r);
+            }
+        }
+        std::vector<Int>().swap(lower[c]);
+        for (Int ch : children[c]) {
+            for (Int r : pattern[ch]) {
+                if (mark[r] != c) {
+                    mark[r] = c;
+                    pc.push_back(r);
+                }
+            }
+        }
+        std::sort(pc.begin(), pc.end());
+        if (!pc.empty()) {
+            parent[c] = pc[0];
+            children[pc[0]].push_back(c);
+        }
+    }
+
+    // Find fundamental supernodes. Column c+1 belongs to the supernode of
+    // column c if it is the parent of c and their patterns coincide (apart
+    // from c+1 itself).
+    snode_start_.clear();
+    snode_of_.assign(m, 0);
+    for (Int c = 0; c < m; c++) {
+        if (c == 0 || !(parent[c-1] == c &&
+                        pattern[c-1].size() == pattern[c].size()+1))
+            snode_start_.push_back(c);
+        snode_of_[c] = snode_start_.size()-1;
+    }
+    snode_start_.push_back(m);
+    const Int nsnode = snode_start_.size()-1;
+
+    snode_rowptr_.assign(nsnode+1, 0);
+    snode_valptr_.assign(nsnode+1, 0);
+    snode_rows_.clear();
+    nnz_L_ = 0;
+    for (Int s = 0; s < nsnode; s++) {
+        const Int first = snode_start_[s];
+        const Int last = snode_start_[s+1]; // one past last column
+        snode_rowptr_[s] = snode_rows_.size();
+        for (Int c = first; c < last; c++)
+            snode_rows_.push_back(c);
+        for (Int r : pattern[last-1])
+            snode_rows_.push_back(r);
+        const Int nrow = snode_rows_.size() - snode_rowptr_[s];
+        const Int ncol = last-first;
+        snode_valptr_[s+1] = snode_valptr_[s] + nrow*ncol;
+        nnz_L_ += nrow*ncol - ncol*(ncol-1)/2;
+        for (Int c = first; c < last; c++)
+            std::vector<Int>().swap(pattern[c]);
+    }
+    snode_rowptr_[nsnode] = snode_rows_.size();
+    values_.assign(snode_valptr_[nsnode], 0.0);
+}
+
+Int SparseCholesky::Factorize(const double* colweight, const double* diag) {
+    const Int m = dim_;
+    const Int nsnode = snode_start_.size()-1;
+    Int num_replaced = 0;
+    factorized_ = false;
+
+    std::vector<double> work(m, 0.0);    // dense column of permuted matrix
+    std::vector<Int> relpos(m, -1);      // position of row in supernode
+    std::vector<Int> next_row(nsnode);   // first row of descendant to update
+    std::vector<Int> link_head(nsnode, -1), link_next(nsnode, -1);
+    std::vector<double> update, orig_diag;
+
+    for (Int s = 0; s < nsnode; s++) {
+        const Int first = snode_start_[s];
+        const Int ncol = snode_start_[s+1]-first;
+        const Int* rows = &snode_rows_[snode_rowptr_[s]];
+        const Int nrow = snode_rowptr_[s+1]-snode_rowptr_[s];
+        double* block = &values_[snode_valptr_[s]];
+        const Int ld = nrow;
+        for (Int t = 0; t < nrow; t++)
+            relpos[rows[t]] = t;
+
+        // Assemble columns of the permuted matrix into the block.
+        orig_diag.assign(ncol, 0.0);
+        for (Int kc = 0; kc < ncol; kc++) {
+            const Int c = first+kc;
+            const Int i = perm_[c];
+            work[c] += diag[i];
+            for (Int p = At_.begin(i); p < At_.end(i); p++) {
+                Int j = At_.index(p);
+                double coef = At_.value(p) * colweight[j];
+                if (coef == 0.0)
+                    continue;
+                for (Int q = A_.begin(j); q < A_.end(j); q++) {
+                    Int r = iperm_[A_.index(q)];
+                    if (r >= c)
+                        work[r] += coef * A_.value(q);
+                }
+            }
+            double* col = block + kc*ld;
+            for (Int t = 0; t < nrow; t++) {
+                col[t] = rows[t] >= c ? work[rows[t]] : 0.0;
+                work[rows[t]] = 0.0;
+            }
+            orig_diag[kc] = col[kc];
+        }
+
+        // Apply updates from descendant supernodes whose next row to update
+        // is in this supernode.
+        Int d = link_head[s];
+        while (d >= 0) {
+            const Int dnext = link_next[d];
+            const Int* drows = &snode_rows_[snode_rowptr_[d]];
+            const Int dnrow = snode_rowptr_[d+1]-snode_rowptr_[d];
+            const Int dncol = snode_start_[d+1]-snode_start_[d];
+            const double* dblock = &values_[snode_valptr_[d]];
+            const Int dld = dnrow;
+            const Int begin = next_row[d];
+            Int end = begin;
+            while (end < dnrow && drows[end] < first+ncol)
+                end++;
+            // update = L_d[begin:dnrow,:] * L_d[begin:end,:]', lower part
+            const Int urow = dnrow-begin;
+            const Int ucol = end-begin;
+            update.assign(urow*ucol, 0.0);
+            for (Int kc = 0; kc < dncol; kc++) {
+                const double* dcol = dblock + kc*dld;
+                for (Int jj = 0; jj < ucol; jj++) {
+                    const double f = dcol[begin+jj];
+                    if (f == 0.0)
+                        continue;
+                    double* ucolumn = &update[jj*urow];
+                    for (Int ii = jj; ii < urow; ii++)
+                        ucolumn[ii] += dcol[begin+ii] * f;
+                }
+            }
+            for (Int jj = 0; jj < ucol; jj++) {
+                double* col = block + (drows[begin+jj]-first)*ld;
+                const double* ucolumn = &update[jj*urow];
+                for (Int ii = jj; ii < urow; ii++)
+                    col[relpos[drows[begin+ii]]] -= ucolumn[ii];
+            }
+            // Link d to the supernode of its next row.
+            next_row[d] = end;
+            if (end < dnrow) {
+                Int s2 = snode_of_[drows[end]];
+                link_next[d] = link_head[s2];
+                link_head[s2] = d;
+            }
+            d = dnext;
+        }
+
+        // Dense factorization of the supernode.
+        for (Int kc = 0; kc < ncol; kc++) {
+            double* col = block + kc*ld;
+            for (Int kk = 0; kk < kc; kk++) {
+                const double* prevcol = block + kk*ld;
+                const double f = prevcol[kc];
+                if (f == 0.0)
+                    continue;
+                for (Int t = kc; t < nrow; t++)
+                    col[t] -= prevcol[t] * f;
+            }
+            double pivot = col[kc];
+            if (!(pivot > kPivotTol * orig_diag[kc]) || !std::isfinite(pivot)) {
+                pivot = kHugePivot;
+                num_replaced++;
+            }
+            const double lkk = std::sqrt(pivot);
+            col[kc] = lkk;
+            for (Int t = kc+1; t < nrow; t++)
+                col[t] /= lkk;
+        }
+        for (Int t = 0; t < nrow; t++)
+            relpos[rows[t]] = -1;
+
+        // Link s to the supernode of its first off-diagonal row.
+        next_row[s] = ncol;
+        if (ncol < nrow) {
+            Int s2 = snode_of_[rows[ncol]];
+            link_next[s] = link_head[s2];
+            link_head[s2] = s;
+        }
+    }
+    factorized_ = true;
+    return num_replaced;
+}
+
+void SparseCholesky::Solve(Vector& x) const {
+    const Int m = dim_;
+    const Int nsnode = snode_start_.size()-1;
+    assert(factorized_);
+    assert(x.size() == m);
+    Vector y(m);
+    for (Int c = 0; c < m; c++)
+        y[c] = x[perm_[c]];
+
+    // Solve with L.
+    for (Int s = 0; s < nsnode; s++) {
+        const Int first = snode_start_[s];
+        const Int ncol = snode_start_[s+1]-first;
+        const Int* rows = &snode_rows_[snode_rowptr_[s]];
+        const Int nrow = snode_rowptr_[s+1]-snode_rowptr_[s];
+        const double* block = &values_[snode_valptr_[s]];
+        for (Int kc = 0; kc < ncol; kc++) {
+            const double* col = block + kc*nrow;
+            double yc = y[first+kc] / col[kc];
+            y[first+kc] = yc;
+            if (yc != 0.0)
+                for (Int t = kc+1; t < nrow; t++)
+                    y[rows[t]] -= col[t] * yc;
+        }
+    }
+
+    // Solve with L'.
+    for (Int s = nsnode-1; s >= 0; s--) {
+        const Int first = snode_start_[s];
+        const Int ncol = snode_start_[s+1]-first;
+        const Int* rows = &snode_rows_[snode_rowptr_[s]];
+        const Int nrow = snode_rowptr_[s+1]-snode_rowptr_[s];
+        const double* block = &values_[snode_valptr_[s]];
+        for (Int kc = ncol-1; kc >= 0; kc--) {
+            const double* col = block + kc*nrow;
+            double yc = y[first+kc];
+            for (Int t = kc+1; t < nrow; t++)
+                yc -= col[t] * y[rows[t]];
+            y[first+kc] = yc / col[kc];
+        }
+    }
+
+    for (Int c = 0; c < m; c++)
+        x[perm_[c]] = y[c];
+}
+
+void SparseCholesky::_Apply(const Vector& rhs, Vector& lhs,
+                            double* rhs_dot_lhs) {
+    Timer timer;
+    lhs = rhs;
+    Solve(lhs);
+    if (rhs_dot_lhs)
+        *rhs_dot_lhs = Dot(rhs,lhs);
+    time_ += timer.Elapsed();
+}
+
+}  // namespace ipx
@@ -0,0 +1,79 @@
+#ifndef IPX_SPARSE_CHOLESKY_H_
+#define IPX_SPARSE_CHOLESKY_H_
+
+#include <vector>
+#include "linear_operator.h"
+#include "sparse_matrix.h"
+
+namespace ipx {
+
+// SparseCholesky computes the factorization
+//
+//   P * (A*diag(colweight)*A' + diag(diag)) * P' = L*L',
+//
+// where A is an m-by-k sparse matrix, P is a fill-reducing permutation and L is
+// lower triangular. The permutation and the nonzero pattern of L depend only
+// on the pattern of A. They are computed once by Analyse() and reused by each
+// call to Factorize(). L is stored by supernodes, i.e. groups of consecutive
+// columns that have the same pattern below their diagonal block. Each
+// supernode is held as a dense column-major block.
+//
+// Pivots that are not sufficiently positive (relative to the diagonal entry of
+// the matrix before factorization) are replaced by a huge value. This sets the
+// corresponding solution component to (almost) zero, which is the usual way to
+// deal with rank deficiency of A*diag(colweight)*A' in interior point methods.
+//
+// As a LinearOperator, the object computes lhs = inverse(L*L') * rhs in the
+// permuted sense defined above.
+
+class SparseCholesky : public LinearOperator {
+public:
+    // Computes a minimum degree ordering of A*A' and the supernodal structure
+    // of L. A copy of A is stored for subsequent calls to Factorize().
+    void Analyse(const SparseMatrix& A);
+
+    // Computes the numeric factorization. @colweight must hold k and @diag m
+    // nonnegative entries. Returns the number of pivots that were replaced.
+    Int Factorize(const double* colweight, const double* diag);
+
+    // Solves (A*diag(colweight)*A' + diag(diag)) * x = rhs with the
+    // factorization, overwriting @x (which holds rhs on entry).
+    void Solve(Vector& x) const;
+
+    // Returns the # entries in L (including diagonal).
+    Int nnz() const { return nnz_L_; }
+
+    // Returns the # supernodes.
+    Int supernodes() const { return (Int) snode_start_.size() - 1; }
+
+    // Returns computation time for calls to Apply() since last reset_time().
+    double time() const { return time_; }
+    void reset_time() { time_ = 0.0; }
+
+private:
+    void _Apply(const Vector& rhs, Vector& lhs, double* rhs_dot_lhs) override;
+
+    Int dim_{0};
+    SparseMatrix A_, At_;           // copy of A and its transpose
+    std::vector<Int> perm_;         // perm_[c] is original index of column c
+    std::vector<Int> iperm_;        // inverse permutation
+    // Supernode s consists of columns snode_start_[s],...,snode_start_[s+1]-1.
+    // Its rows (in permuted index space) are snode_rows_[p], where p ranges
+    // from snode_rowptr_[s] to snode_rowptr_[s+1]-1. The first rows are the
+    // columns of the supernode. snode_of_[c] is the supernode of column c.
+    std::vector<Int> snode_start_;
+    std::vector<Int> snode_rowptr_;
+    std::vector<Int> snode_rows_;
+    std::vector<Int> snode_of_;
+    // The dense block of supernode s starts at values_[snode_valptr_[s]] and
+    // has leading dimension snode_rowptr_[s+1]-snode_rowptr_[s].
+    std::vector<Int> snode_valptr_;
+    std::vector<double> values_;
+    Int nnz_L_{0};
+    bool factorized_{false};
+    double time_{0.0};
+};
+
+}  // namespace ipx
+
+#endif  // IPX_SPARSE_CHOLESKY_H_
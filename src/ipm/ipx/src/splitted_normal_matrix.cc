@@ -1,12 +1,41 @@
 #include "splitted_normal_matrix.h"
 #include <cassert>
 #include <cmath>
+#include "parallel/HighsParallel.h"
 #include "timer.h"
 #include "utils.h"
 
 namespace ipx {
 
-SplittedNormalMatrix::SplittedNormalMatrix(const Model& model) : model_(model) {
+// Number of columns or rows of N processed by one task in parallel mode
+static const Int kParallelGrainSize = 1024;
+
+// Computes lhs = N*N'*rhs in two passes, first by columns of N, second by
+// rows, each split into blocks that are processed as tasks. Since the rows of
+// Nt are sorted by column index, each lhs[i] is summed in the same order as
+// in AddNormalProduct().
+static void ParallelNormalProduct(const SparseMatrix& N, const SparseMatrix& Nt,
+                                  const Vector& rhs, Vector& work,
+                                  Vector& lhs) {
+    const Int m = N.rows();
+    const Int n = N.cols();
+    assert(work.size() == n);
+    highs::parallel::for_each(0, n, [&](Int first, Int last) {
+        for (Int j = first; j < last; j++)
+            work[j] = DotColumn(N, j, rhs);
+    }, kParallelGrainSize);
+    highs::parallel::for_each(0, m, [&](Int first, Int last) {
+        for (Int i = first; i < last; i++) {
+            double d = 0.0;
+            for (Int p = Nt.begin(i); p < Nt.end(i); p++)
+                d += work[Nt.index(p)] * Nt.value(p);
+            lhs[i] = d;
+        }
+    }, kParallelGrainSize);
+}
+
+SplittedNormalMatrix::SplittedNormalMatrix(const Model& model, bool parallel) :
+    model_(model), parallel_(parallel) {
     Int m = model_.rows();
     colperm_.resize(m);
     rowperm_inv_.resize(m);
@@ -20,6 +49,7 @@ void SplittedNormalMatrix::Prepare(const Basis& basis, const double* colscale) {
     assert(colscale);
     prepared_ = false;
     N_.clear();                 // deallocate old memory
+    Nt_.clear();
 
     basis.GetLuFactors(&L_, &U_, rowperm_inv_.data(), colperm_.data());
     rowperm_inv_ = InversePerm(rowperm_inv_);
@@ -51,6 +81,10 @@ void SplittedNormalMatrix::Prepare(const Basis& basis, const double* colscale) {
         assert(std::isfinite(d));
         ScaleColumn(N_, k, d);
     }
+    if (parallel_) {
+        Nt_ = Transpose(N_);
+        work_N_.resize(N_.cols());
+    }
 
     // Build list of free variables.
     free_positions_.clear();
@@ -97,9 +131,13 @@ void SplittedNormalMatrix::_Apply(const Vector& rhs, Vector& lhs,
     time_Bt_ += timer.Elapsed();
 
     // Compute lhs = N*N' * work.
-    lhs = 0.0;
     timer.Reset();
-    AddNormalProduct(N_, nullptr, work_, lhs);
+    if (parallel_) {
+        ParallelNormalProduct(N_, Nt_, work_, work_N_, lhs);
+    } else {
+        lhs = 0.0;
+        AddNormalProduct(N_, nullptr, work_, lhs);
+    }
     time_NNt_ += timer.Elapsed();
 
     // Compute lhs := inverse(B) * lhs.
@@ -24,8 +24,10 @@ namespace ipx {
 class SplittedNormalMatrix : public LinearOperator {
 public:
     // Constructor stores a reference to the model. No data is copied. The model
-    // must be valid as long as the object is used.
-    explicit SplittedNormalMatrix(const Model& model);
+    // must be valid as long as the object is used. If @parallel is true, then
+    // products with N*N' are computed by the HiGHS task scheduler. The result
+    // is identical to that of the serial computation.
+    explicit SplittedNormalMatrix(const Model& model, bool parallel = false);
 
     // Prepares object for subsequent calls to Apply(). @colscale must hold n+m
     // scaling factors for the columns of AI. The scaling factors are copied.
@@ -48,10 +50,13 @@ private:
     SparseMatrix L_;           // lower triangular factor without unit diagonal
     SparseMatrix U_;           // upper triangular factor with scaled columns
     SparseMatrix N_;           // N with scaled columns and permuted row indices
+    SparseMatrix Nt_;          // transpose of N_ (parallel mode only)
     std::vector<Int> free_positions_; // positions corresponding to free vars
     std::vector<Int> colperm_;        // column permutation from LU factor
     std::vector<Int> rowperm_inv_;    // inverse row permutation from LU factor
     Vector work_;                     // size m workspace
+    Vector work_N_;                   // size cols(N) workspace (parallel only)
+    bool parallel_{false};            // use HiGHS task scheduler?
     bool prepared_{false};            // operator prepared?
     double time_B_{0.0};              // time solves with B
     double time_Bt_{0.0};             // time solves with B'
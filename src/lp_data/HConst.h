@@ -81,6 +81,21 @@ enum HighsAnalysisLevel {
       kHighsAnalysisLevelNlaData + kHighsAnalysisLevelNlaTime
 };
 
+enum MipParallelTreeSearch {
+  kMipParallelTreeSearchMin = 0,
+  kMipParallelTreeSearchOff = kMipParallelTreeSearchMin,  // 0
+  kMipParallelTreeSearchDeterministic,                    // 1
+  kMipParallelTreeSearchOpportunistic,                    // 2
+  kMipParallelTreeSearchMax = kMipParallelTreeSearchOpportunistic
+};
+
+enum IpmKktSolver {
+  kIpmKktSolverMin = 0,
+  kIpmKktSolverIterative = kIpmKktSolverMin,  // 0
+  kIpmKktSolverCholesky,                      // 1
+  kIpmKktSolverMax = kIpmKktSolverCholesky
+};
+
 enum class HighsVarType : uint8_t {
   kContinuous = 0,
   kInteger = 1,
@@ -175,8 +190,23 @@ enum class HighsModelStatus {
   kTimeLimit,
   kIterationLimit,
   kUnknown,
+  kInterrupt,
   kMin = kNotset,
-  kMax = kUnknown
+  kMax = kInterrupt
+};
+
+// Callback types: values are shared with the C API, so add new types
+// to the end
+enum HighsCallbackType : int {
+  kCallbackMin = 0,
+  kCallbackSimplexIteration = kCallbackMin,  // 0
+  kCallbackIpmIteration,                     // 1
+  kCallbackPresolveComplete,                 // 2
+  kCallbackMipNode,                          // 3
+  kCallbackMipImprovingSolution,             // 4
+  kCallbackMipCutRound,                      // 5
+  kCallbackMax = kCallbackMipCutRound,
+  kNumCallbackType
 };
 
 /** SCIP/CPLEX-like HiGHS basis status for columns and rows. */
@@ -207,6 +237,10 @@ const HighsInt kHighsIllegalErrorIndex = -1;
 // Maximum upper bound on semi-variables
 const double kMaxSemiVariableUpper = 1e5;
 
+// Scale from the deterministic operation counts (synthetic ticks) of
+// the solvers to the work units that back the work_limit option
+const double kHighsWorkUnitsPerTick = 1e-6;
+
 // Termination link in linked lists
 const HighsInt kNoLink = -1;
 
@@ -51,6 +51,9 @@ struct HotStart {
   bool valid = false;
   RefactorInfo refactor_info;
   std::vector<int8_t> nonbasicMove;
+  // Dual steepest edge weights for the basic variables in the order
+  // of refactor_info.pivot_var: empty if they are not known
+  std::vector<double> dual_edge_weight;
   void clear();
 };
 
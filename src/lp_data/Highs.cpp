@@ -19,6 +19,7 @@
 #include <cassert>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 
 #include "io/Filereader.h"
@@ -45,6 +46,7 @@ HighsStatus Highs::clear() {
 
 HighsStatus Highs::clearModel() {
   model_.clear();
+  mip_hot_start_.reset();
   return clearSolver();
 }
 
@@ -953,6 +955,31 @@ HighsStatus Highs::run() {
     options_.lp_presolve_requires_basis_postsolve =
         lp_presolve_requires_basis_postsolve;
 
+    // Give the user the chance to inspect the presolved LP dimensions,
+    // and to interrupt the solve
+    if (callback_.callbackActive(kCallbackPresolveComplete) &&
+        (model_presolve_status_ == HighsPresolveStatus::kNotReduced ||
+         model_presolve_status_ == HighsPresolveStatus::kReduced ||
+         model_presolve_status_ == HighsPresolveStatus::kReducedToEmpty)) {
+      const HighsLp& presolved_lp =
+          model_presolve_status_ == HighsPresolveStatus::kNotReduced
+              ? incumbent_lp
+              : presolve_.getReducedProblem();
+      callback_.clearHighsCallbackDataOut();
+      callback_.data_out.running_time = timer_.readRunHighsClock();
+      callback_.data_out.presolved_num_col = presolved_lp.num_col_;
+      callback_.data_out.presolved_num_row = presolved_lp.num_row_;
+      callback_.data_out.presolved_num_nz = presolved_lp.a_matrix_.numNz();
+      if (callback_.callbackAction(kCallbackPresolveComplete,
+                                   "Presolve complete")) {
+        setHighsModelStatusAndClearSolutionAndBasis(
+            HighsModelStatus::kInterrupt);
+        highsLogUser(log_options, HighsLogType::kInfo,
+                     "Interrupted by user after presolve\n");
+        return returnFromRun(HighsStatus::kWarning);
+      }
+    }
+
     // Set an illegal local pivot threshold value that's updated after
     // solving the presolved LP - if simplex is used
     double factor_pivot_threshold = -1;
@@ -1059,7 +1086,8 @@ HighsStatus Highs::run() {
             model_status_ == HighsModelStatus::kUnbounded ||
             model_status_ == HighsModelStatus::kUnboundedOrInfeasible ||
             model_status_ == HighsModelStatus::kTimeLimit ||
-            model_status_ == HighsModelStatus::kIterationLimit;
+            model_status_ == HighsModelStatus::kIterationLimit ||
+            model_status_ == HighsModelStatus::kInterrupt;
         break;
       }
       case HighsPresolveStatus::kReducedToEmpty: {
@@ -1222,9 +1250,11 @@ HighsStatus Highs::run() {
             HighsOptions save_options = options_;
             const bool full_logging = false;
             if (full_logging) options_.log_dev_level = kHighsLogDevLevelVerbose;
-            // Force the use of simplex to clean up if IPM has been used
-            // to solve the presolved problem
-            if (options_.solver == kIpmString) options_.solver = kSimplexString;
+            // Force the use of simplex to clean up if IPM, possibly
+            // concurrently, has been used to solve the presolved problem
+            if (options_.solver == kIpmString ||
+                options_.solver == kConcurrentString)
+              options_.solver = kSimplexString;
             options_.simplex_strategy = kSimplexStrategyChoose;
             // Ensure that the parallel solver isn't used
             options_.simplex_min_concurrency = 1;
@@ -1292,7 +1322,8 @@ HighsStatus Highs::run() {
            model_status_ == HighsModelStatus::kUnboundedOrInfeasible ||
            model_status_ == HighsModelStatus::kTimeLimit ||
            model_status_ == HighsModelStatus::kIterationLimit ||
-           model_status_ == HighsModelStatus::kUnknown);
+           model_status_ == HighsModelStatus::kUnknown ||
+           model_status_ == HighsModelStatus::kInterrupt);
     // The HEkk data correspond to the (strictly reduced) presolved LP
     // so must be cleared
     ekk_instance_.clear();
@@ -1369,6 +1400,67 @@ HighsStatus Highs::run() {
   return returnFromRun(return_status);
 }
 
+// Workspaces used by Highs::solveBatch. A task takes one for the
+// duration of its range of models and then returns it, so the number
+// created is bounded by the number of tasks active at once
+struct HighsBatchPool {
+  std::mutex mutex;
+  std::vector<std::unique_ptr<Highs>> free;
+};
+
+HighsStatus Highs::solveBatch(const std::vector<HighsLp>& lps,
+                              std::vector<HighsBatchResult>& results) {
+  const HighsInt num_lp = lps.size();
+  results.assign(num_lp, HighsBatchResult());
+  if (num_lp == 0) return HighsStatus::kOk;
+
+  highs::parallel::initialize_scheduler(options_.threads);
+  if (!batch_pool_) batch_pool_ = std::make_shared<HighsBatchPool>();
+  HighsBatchPool& pool = *batch_pool_;
+  // Workspaces take the current options, but the models are solved
+  // silently
+  auto setWorkspaceOptions = [&](Highs& workspace) {
+    workspace.passOptions(options_);
+    workspace.setOptionValue("output_flag", false);
+  };
+  for (std::unique_ptr<Highs>& workspace : pool.free)
+    setWorkspaceOptions(*workspace);
+
+  highs::parallel::for_each(0, num_lp, [&](HighsInt start, HighsInt end) {
+    std::unique_ptr<Highs> workspace;
+    {
+      std::lock_guard<std::mutex> lock(pool.mutex);
+      if (!pool.free.empty()) {
+        workspace = std::move(pool.free.back());
+        pool.free.pop_back();
+      }
+    }
+    if (!workspace) {
+      workspace.reset(new Highs());
+      setWorkspaceOptions(*workspace);
+    }
+    for (HighsInt iX = start; iX < end; iX++) {
+      HighsBatchResult& result = results[iX];
+      result.run_status = workspace->passModel(lps[iX]);
+      if (result.run_status == HighsStatus::kError) continue;
+      result.run_status = workspace->run();
+      result.model_status = workspace->getModelStatus();
+      const HighsInfo& info = workspace->getInfo();
+      result.objective_function_value = info.objective_function_value;
+      result.simplex_iteration_count = info.simplex_iteration_count;
+      result.solution = workspace->getSolution();
+      result.basis = workspace->getBasis();
+    }
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    pool.free.push_back(std::move(workspace));
+  });
+
+  HighsStatus return_status = HighsStatus::kOk;
+  for (const HighsBatchResult& result : results)
+    return_status = worseStatus(result.run_status, return_status);
+  return return_status;
+}
+
 HighsStatus Highs::getDualRay(bool& has_dual_ray, double* dual_ray_value) {
   if (!ekk_instance_.status_.has_invert)
     return invertRequirementError("getDualRay");
@@ -1655,6 +1747,39 @@ HighsStatus Highs::setLogCallback(void (*log_callback)(HighsLogType,
   return HighsStatus::kOk;
 }
 
+HighsStatus Highs::setCallback(HighsCallbackFunctionType user_callback,
+                               void* user_callback_data) {
+  callback_.clear();
+  callback_.user_callback = user_callback;
+  callback_.user_callback_data = user_callback_data;
+  return HighsStatus::kOk;
+}
+
+HighsStatus Highs::startCallback(const int callback_type) {
+  if (callback_type < kCallbackMin || callback_type > kCallbackMax) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "Cannot start callback of illegal type %d\n", callback_type);
+    return HighsStatus::kError;
+  }
+  if (!callback_.user_callback) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "Cannot start callback when user_callback not defined\n");
+    return HighsStatus::kError;
+  }
+  callback_.active[callback_type] = true;
+  return HighsStatus::kOk;
+}
+
+HighsStatus Highs::stopCallback(const int callback_type) {
+  if (callback_type < kCallbackMin || callback_type > kCallbackMax) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "Cannot stop callback of illegal type %d\n", callback_type);
+    return HighsStatus::kError;
+  }
+  callback_.active[callback_type] = false;
+  return HighsStatus::kOk;
+}
+
 HighsStatus Highs::setBasis(const HighsBasis& basis, const std::string origin) {
   if (basis.alien) {
     // An alien basis needs to be checked properly, since it may be
@@ -2636,6 +2761,7 @@ HighsStatus Highs::callSolveLp(HighsLp& lp, const string message) {
   // class, and the scaled/unscaled model status
   HighsLpSolverObject solver_object(lp, basis_, solution_, info_, ekk_instance_,
                                     options_, timer_);
+  solver_object.callback_ = &callback_;
 
   // Check that the model is column-wise
   assert(model_.lp_.a_matrix_.isColwise());
@@ -2803,7 +2929,18 @@ HighsStatus Highs::callSolveMip() {
   }
   HighsLp& lp = has_semi_variables ? use_lp : model_.lp_;
   HighsMipSolver solver(options_, lp, solution_);
+  solver.callback_ = &callback_;
+  // Discard any hot start data when the dimensions of the model have
+  // changed since it was retained
+  if (mip_hot_start_ && !mip_hot_start_->compatible(lp))
+    mip_hot_start_.reset();
+  if (options_.mip_incremental && mip_hot_start_)
+    solver.hotstart = mip_hot_start_.get();
   solver.run();
+  if (options_.mip_incremental) {
+    if (!mip_hot_start_) mip_hot_start_ = std::make_shared<HighsMipHotStart>();
+    solver.saveHotStart(*mip_hot_start_);
+  }
   options_.log_dev_level = log_dev_level;
   // Set the return_status, model status and, for completeness, scaled
   // model status
@@ -2850,6 +2987,7 @@ HighsStatus Highs::callSolveMip() {
   info_.mip_node_count = solver.node_count_;
   info_.mip_dual_bound = solver.dual_bound_;
   info_.mip_gap = solver.gap_;
+  info_.work_units = solver.work_units_;
   info_.valid = true;
   if (model_status_ == HighsModelStatus::kOptimal)
     checkOptimality("MIP", return_status);
@@ -3120,6 +3258,7 @@ HighsStatus Highs::returnFromRun(const HighsStatus run_return_status) {
     case HighsModelStatus::kTimeLimit:
     case HighsModelStatus::kIterationLimit:
     case HighsModelStatus::kUnknown:
+    case HighsModelStatus::kInterrupt:
       assert(return_status == HighsStatus::kWarning);
       break;
     default:
@@ -3157,6 +3296,7 @@ HighsStatus Highs::returnFromRun(const HighsStatus run_return_status) {
     case HighsModelStatus::kTimeLimit:
     case HighsModelStatus::kIterationLimit:
     case HighsModelStatus::kUnknown:
+    case HighsModelStatus::kInterrupt:
       // Have info and primal solution (unless infeasible). No primal solution
       // in some other case, too!
       assert(have_info == true);
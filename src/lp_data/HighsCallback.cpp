@@ -0,0 +1,63 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file lp_data/HighsCallback.cpp
+ * @brief
+ */
+#include "lp_data/HighsCallback.h"
+
+#include <cassert>
+
+void HighsCallback::clear() {
+  this->user_callback = nullptr;
+  this->user_callback_data = nullptr;
+  this->active.assign(kNumCallbackType, false);
+  this->clearHighsCallbackDataOut();
+  this->clearHighsCallbackDataIn();
+}
+
+void HighsCallback::clearHighsCallbackDataOut() {
+  this->data_out.running_time = -1;
+  this->data_out.simplex_iteration_count = -1;
+  this->data_out.ipm_iteration_count = -1;
+  this->data_out.objective_function_value = -kHighsInf;
+  this->data_out.mip_node_count = -1;
+  this->data_out.mip_primal_bound = kHighsInf;
+  this->data_out.mip_dual_bound = -kHighsInf;
+  this->data_out.mip_gap = -1;
+  this->data_out.mip_cut_round = -1;
+  this->data_out.mip_solution_size = 0;
+  this->data_out.mip_solution = nullptr;
+  this->data_out.presolved_num_col = -1;
+  this->data_out.presolved_num_row = -1;
+  this->data_out.presolved_num_nz = -1;
+}
+
+void HighsCallback::clearHighsCallbackDataIn() {
+  this->data_in.user_interrupt = 0;
+}
+
+bool HighsCallback::callbackActive(const int callback_type) const {
+  if (callback_type < kCallbackMin || callback_type > kCallbackMax)
+    return false;
+  if (!this->user_callback) return false;
+  return this->active[callback_type];
+}
+
+bool HighsCallback::callbackAction(const int callback_type,
+                                   const std::string& message) {
+  if (!callbackActive(callback_type)) return false;
+  this->clearHighsCallbackDataIn();
+  this->user_callback(callback_type, message, &this->data_out, &this->data_in,
+                      this->user_callback_data);
+  return this->data_in.user_interrupt != 0;
+}
@@ -0,0 +1,51 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file lp_data/HighsCallback.h
+ * @brief User callback invoked by the solvers at progress events
+ */
+#ifndef LP_DATA_HIGHSCALLBACK_H_
+#define LP_DATA_HIGHSCALLBACK_H_
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "lp_data/HConst.h"
+#include "lp_data/HighsCallbackStruct.h"
+
+using HighsCallbackFunctionType =
+    std::function<void(int, const std::string&, const HighsCallbackDataOut*,
+                       HighsCallbackDataIn*, void*)>;
+
+struct HighsCallback {
+  HighsCallbackFunctionType user_callback = nullptr;
+  void* user_callback_data = nullptr;
+  std::vector<bool> active = std::vector<bool>(kNumCallbackType, false);
+  HighsCallbackDataOut data_out;
+  HighsCallbackDataIn data_in;
+
+  HighsCallback() {
+    clearHighsCallbackDataOut();
+    clearHighsCallbackDataIn();
+  }
+  void clear();
+  void clearHighsCallbackDataOut();
+  void clearHighsCallbackDataIn();
+  // Whether the user callback is defined and active for callback_type
+  bool callbackActive(const int callback_type) const;
+  // Call the user callback with the current data_out, returning
+  // whether the user requests an interrupt
+  bool callbackAction(const int callback_type, const std::string& message = "");
+};
+
+#endif /* LP_DATA_HIGHSCALLBACK_H_ */
@@ -0,0 +1,66 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file lp_data/HighsCallbackStruct.h
+ * @brief Data passed to and from user callbacks: C-compatible so that
+ * it can be shared with the C API
+ */
+#ifndef LP_DATA_HIGHSCALLBACKSTRUCT_H_
+#define LP_DATA_HIGHSCALLBACKSTRUCT_H_
+
+#include "util/HighsInt.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Data passed from HiGHS to the user callback. Only the fields
+ * relevant to the callback type are guaranteed to be current.
+ */
+typedef struct {
+  double running_time;
+  HighsInt simplex_iteration_count;
+  HighsInt ipm_iteration_count;
+  double objective_function_value;
+  int64_t mip_node_count;
+  double mip_primal_bound;
+  double mip_dual_bound;
+  double mip_gap;
+  HighsInt mip_cut_round;
+  // Solution vector: only set for kCallbackMipImprovingSolution
+  HighsInt mip_solution_size;
+  const double* mip_solution;
+  // Presolved model dimensions: only set for kCallbackPresolveComplete
+  HighsInt presolved_num_col;
+  HighsInt presolved_num_row;
+  HighsInt presolved_num_nz;
+} HighsCallbackDataOut;
+
+/**
+ * Data passed from the user callback to HiGHS
+ */
+typedef struct {
+  // Set nonzero to interrupt the solve
+  int user_interrupt;
+} HighsCallbackDataIn;
+
+typedef void (*HighsCCallbackType)(int callback_type, const char* message,
+                                   const HighsCallbackDataOut* data_out,
+                                   HighsCallbackDataIn* data_in,
+                                   void* user_callback_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LP_DATA_HIGHSCALLBACKSTRUCT_H_ */
@@ -26,6 +26,7 @@ void HighsInfo::invalidate() {
   ipm_iteration_count = -1;
   crossover_iteration_count = -1;
   qp_iteration_count = -1;
+  work_units = -1;
   primal_solution_status = kSolutionStatusNone;
   dual_solution_status = kSolutionStatusNone;
   basis_validity = kBasisValidityInvalid;
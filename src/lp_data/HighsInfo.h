@@ -134,6 +134,7 @@ struct HighsInfoStruct {
   HighsInt ipm_iteration_count;
   HighsInt qp_iteration_count;
   HighsInt crossover_iteration_count;
+  double work_units;
   HighsInt primal_solution_status;
   HighsInt dual_solution_status;
   HighsInt basis_validity;
@@ -217,6 +218,11 @@ class HighsInfo : public HighsInfoStruct {
                                    &crossover_iteration_count, 0);
     records.push_back(record_int);
 
+    record_double = new InfoRecordDouble(
+        "work_units", "Deterministic work units of the run, see work_limit",
+        advanced, &work_units, 0);
+    records.push_back(record_double);
+
     record_int =
         new InfoRecordInt("qp_iteration_count", "Iteration count for QP solver",
                           advanced, &qp_iteration_count, 0);
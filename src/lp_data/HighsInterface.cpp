@@ -1242,6 +1242,14 @@ HighsStatus Highs::setHotStartInterface(const HotStart& hot_start) {
                 "columns+rows are incompatible\n",
                 (int)hot_start_num_tot, (int)num_tot);
   }
+  hot_start_num_row = (int)hot_start.dual_edge_weight.size();
+  if (hot_start_num_row && hot_start_num_row != num_row) {
+    hot_start_ok = false;
+    highsLogDev(options_.log_options, HighsLogType::kError,
+                "setHotStart: dual_edge_weight.size of %d and LP with "
+                "%d rows are incompatible\n",
+                (int)hot_start_num_row, (int)num_row);
+  }
   if (!hot_start_ok) {
     highsLogUser(options_.log_options, HighsLogType::kError,
                  "setHotStart called with incompatible data\n");
@@ -1348,6 +1356,16 @@ HighsStatus Highs::setHotStartInterface(const HotStart& hot_start) {
   ekk_instance_.status_.has_basis = true;
   ekk_instance_.setNlaRefactorInfo();
   ekk_instance_.updateStatus(LpAction::kHotStart);
+  // Use any dual edge weights, so that they need not be computed
+  // when solving from the hot start
+  ekk_instance_.hot_start_.dual_edge_weight = hot_start.dual_edge_weight;
+  if (hot_start.dual_edge_weight.size()) {
+    ekk_instance_.dual_edge_weight_ = hot_start.dual_edge_weight;
+    ekk_instance_.scattered_dual_edge_weight_.resize(num_tot);
+    ekk_instance_.status_.has_dual_steepest_edge_weights = true;
+  } else {
+    ekk_instance_.status_.has_dual_steepest_edge_weights = false;
+  }
   return HighsStatus::kOk;
 }
 
@@ -1356,6 +1374,7 @@ void Highs::zeroIterationCounts() {
   info_.ipm_iteration_count = 0;
   info_.crossover_iteration_count = 0;
   info_.qp_iteration_count = 0;
+  info_.work_units = 0;
 }
 
 HighsStatus Highs::getDualRayInterface(bool& has_dual_ray,
@@ -16,6 +16,9 @@
 #ifndef LP_DATA_HIGHS_LP_SOLVER_OBJECT_H_
 #define LP_DATA_HIGHS_LP_SOLVER_OBJECT_H_
 
+#include <atomic>
+
+#include "lp_data/HighsCallback.h"
 #include "lp_data/HighsInfo.h"
 #include "lp_data/HighsOptions.h"
 #include "simplex/HEkk.h"
@@ -42,6 +45,10 @@ class HighsLpSolverObject {
   HighsTimer& timer_;
 
   HighsModelStatus model_status_ = HighsModelStatus::kNotset;
+  // Flag that another thread may raise to interrupt the solve
+  const std::atomic<bool>* interrupt_flag_ = nullptr;
+  // User callback, if any, invoked by the solver at progress events
+  HighsCallback* callback_ = nullptr;
 };
 
 #endif  // LP_DATA_HIGHS_LP_SOLVER_OBJECT_H_
@@ -1217,6 +1217,9 @@ std::string utilModelStatusToString(const HighsModelStatus model_status) {
     case HighsModelStatus::kUnknown:
       return "Unknown";
       break;
+    case HighsModelStatus::kInterrupt:
+      return "Interrupted by user";
+      break;
     default:
       assert(1 == 0);
       return "Unrecognised HiGHS model status";
@@ -1258,6 +1261,8 @@ HighsStatus highsStatusFromHighsModelStatus(HighsModelStatus model_status) {
       return HighsStatus::kWarning;
     case HighsModelStatus::kUnknown:
       return HighsStatus::kWarning;
+    case HighsModelStatus::kInterrupt:
+      return HighsStatus::kWarning;
     default:
       return HighsStatus::kError;
   }
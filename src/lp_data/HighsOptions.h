@@ -244,6 +244,7 @@ void reportOption(FILE* file, const OptionRecordString& option,
 
 const string kSimplexString = "simplex";
 const string kIpmString = "ipm";
+const string kConcurrentString = "concurrent";
 
 const HighsInt kKeepNRowsDeleteRows = -1;
 const HighsInt kKeepNRowsDeleteEntries = 0;
@@ -282,6 +283,7 @@ struct HighsOptionsStruct {
   double ipm_optimality_tolerance;
   double objective_bound;
   double objective_target;
+  double work_limit;
   HighsInt random_seed;
   HighsInt threads;
   HighsInt highs_debug_level;
@@ -296,6 +298,7 @@ struct HighsOptionsStruct {
   HighsInt simplex_min_concurrency;
   HighsInt simplex_max_concurrency;
   HighsInt ipm_iteration_limit;
+  HighsInt ipm_kkt_solver;
   std::string write_model_file;
   std::string solution_file;
   std::string log_file;
@@ -323,6 +326,7 @@ struct HighsOptionsStruct {
   HighsInt max_dual_simplex_cleanup_level;
   HighsInt max_dual_simplex_phase1_cleanup_level;
   HighsInt simplex_price_strategy;
+  HighsInt simplex_prefetch_distance;
   HighsInt simplex_unscaled_solution_strategy;
   HighsInt presolve_substitution_maxfillin;
   bool simplex_initial_condition_check;
@@ -364,6 +368,12 @@ struct HighsOptionsStruct {
   HighsInt mip_pscost_minreliable;
   HighsInt mip_min_cliquetable_entries_for_parallelism;
   HighsInt mip_report_level;
+  HighsInt mip_parallel_tree_search;
+  bool mip_parallel_strong_branching;
+  bool mip_concurrent_root_heuristics;
+  HighsInt mip_root_racers;
+  double mip_node_queue_memory_limit;
+  bool mip_incremental;
   double mip_feasibility_tolerance;
   double mip_rel_gap;
   double mip_abs_gap;
@@ -441,7 +451,8 @@ class HighsOptions : public HighsOptionsStruct {
     records.push_back(record_string);
 
     record_string = new OptionRecordString(
-        kSolverString, "Solver option: \"simplex\", \"choose\" or \"ipm\"",
+        kSolverString,
+        "Solver option: \"simplex\", \"choose\", \"ipm\" or \"concurrent\"",
         advanced, &solver, kHighsChooseString);
     records.push_back(record_string);
 
@@ -516,6 +527,13 @@ class HighsOptions : public HighsOptionsStruct {
         &objective_target, -kHighsInf, -kHighsInf, kHighsInf);
     records.push_back(record_double);
 
+    record_double = new OptionRecordDouble(
+        "work_limit",
+        "Limit on the deterministic work units of a run: unlike time_limit, "
+        "reaching it gives the same result on every run",
+        advanced, &work_limit, 0, kHighsInf, kHighsInf);
+    records.push_back(record_double);
+
     record_int =
         new OptionRecordInt(kRandomSeedString, "random seed used in HiGHS",
                             advanced, &random_seed, 0, 0, kHighsIInf);
@@ -597,6 +615,15 @@ class HighsOptions : public HighsOptionsStruct {
         &ipm_iteration_limit, 0, kHighsIInf, kHighsIInf);
     records.push_back(record_int);
 
+    record_int = new OptionRecordInt(
+        "ipm_kkt_solver",
+        "IPM KKT solver: 0 => iterative (conjugate residuals with diagonal "
+        "then basis preconditioning); 1 => Cholesky factorization of the "
+        "normal equations",
+        advanced, &ipm_kkt_solver, kIpmKktSolverMin, kIpmKktSolverIterative,
+        kIpmKktSolverMax);
+    records.push_back(record_int);
+
     record_int = new OptionRecordInt(
         "simplex_min_concurrency",
         "Minimum level of concurrency in parallel simplex", advanced,
@@ -778,6 +805,49 @@ class HighsOptions : public HighsOptionsStruct {
                             advanced, &mip_report_level, 0, 1, 2);
     records.push_back(record_int);
 
+    record_int = new OptionRecordInt(
+        "mip_parallel_tree_search",
+        "Parallel MIP tree search using one worker per thread: 0 => off; 1 => "
+        "deterministic; 2 => opportunistic",
+        advanced, &mip_parallel_tree_search, kMipParallelTreeSearchMin,
+        kMipParallelTreeSearchOff, kMipParallelTreeSearchMax);
+    records.push_back(record_int);
+
+    record_bool = new OptionRecordBool(
+        "mip_parallel_strong_branching",
+        "Evaluate strong branching candidates concurrently on copies of the "
+        "LP relaxation",
+        advanced, &mip_parallel_strong_branching, false);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "mip_concurrent_root_heuristics",
+        "Search for primal solutions with sub-MIPs in background tasks while "
+        "the root node is evaluated",
+        advanced, &mip_concurrent_root_heuristics, false);
+    records.push_back(record_bool);
+
+    record_int = new OptionRecordInt(
+        "mip_root_racers",
+        "Number of root node evaluations raced with different random seeds "
+        "and settings: 1 => off",
+        advanced, &mip_root_racers, 1, 1, 64);
+    records.push_back(record_int);
+
+    record_double = new OptionRecordDouble(
+        "mip_node_queue_memory_limit",
+        "Memory limit in MB for the open nodes of the MIP search, above which "
+        "nodes are compressed and spilled to a temporary file",
+        advanced, &mip_node_queue_memory_limit, 0, kHighsInf, kHighsInf);
+    records.push_back(record_double);
+
+    record_bool = new OptionRecordBool(
+        "mip_incremental",
+        "Retain the incumbent, pseudocosts and root basis of a MIP solve to "
+        "hot start the next solve after the costs or bounds are changed",
+        advanced, &mip_incremental, false);
+    records.push_back(record_bool);
+
     record_double = new OptionRecordDouble(
         "mip_feasibility_tolerance", "MIP feasibility tolerance", advanced,
         &mip_feasibility_tolerance, 1e-10, 1e-6, kHighsInf);
@@ -897,6 +967,13 @@ class HighsOptions : public HighsOptionsStruct {
         kSimplexPriceStrategyRowSwitchColSwitch, kSimplexPriceStrategyMax);
     records.push_back(record_int);
 
+    record_int = new OptionRecordInt(
+        "simplex_prefetch_distance",
+        "Number of entries ahead that the indexed loops of dual simplex "
+        "prefetch the work arrays: 0 => no prefetching",
+        advanced, &simplex_prefetch_distance, 0, 0, 256);
+    records.push_back(record_int);
+
     record_int =
         new OptionRecordInt("simplex_unscaled_solution_strategy",
                             "Strategy for solving unscaled LP in simplex",
@@ -193,7 +193,7 @@ bool loadOptions(const HighsLogOptions& report_log_options, int argc,
   }
 
   if (model_file.size() == 0) {
-    std::cout << "Please specify filename in .mps|.lp|.ems format.\n";
+    std::cout << "Please specify filename in .mps|.lp|.ems|.hmodel format.\n";
     return false;
   }
 
@@ -14,8 +14,11 @@
  * @brief Class-independent utilities for HiGHS
  */
 
+#include <memory>
+
 #include "ipm/IpxWrapper.h"
 #include "lp_data/HighsSolutionDebug.h"
+#include "parallel/HighsParallel.h"
 #include "simplex/HApp.h"
 
 // The method below runs simplex or ipx solver on the lp.
@@ -45,6 +48,12 @@ HighsStatus solveLp(HighsLpSolverObject& solver_object, const string message) {
     return_status = interpretCallStatus(options.log_options, call_status,
                                         return_status, "solveUnconstrainedLp");
     if (return_status == HighsStatus::kError) return return_status;
+  } else if (options.solver == kConcurrentString) {
+    // Race simplex and IPM
+    call_status = solveLpConcurrent(solver_object);
+    return_status = interpretCallStatus(options.log_options, call_status,
+                                        return_status, "solveLpConcurrent");
+    if (return_status == HighsStatus::kError) return return_status;
   } else if (options.solver == kIpmString) {
     // Use IPM
     bool imprecise_solution;
@@ -119,6 +128,123 @@ HighsStatus solveLp(HighsLpSolverObject& solver_object, const string message) {
   return return_status;
 }
 
+namespace {
+// Instances of the data required by one solver in a concurrent LP solve
+struct LpRacer {
+  explicit LpRacer(const HighsTimer& run_timer) : timer(run_timer) {}
+  std::string name;
+  HighsLp lp;
+  HighsBasis basis;
+  HighsSolution solution;
+  HighsInfo highs_info;
+  HEkk ekk_instance;
+  HighsOptions options;
+  HighsTimer timer;
+  HighsStatus return_status = HighsStatus::kError;
+  HighsModelStatus model_status = HighsModelStatus::kNotset;
+};
+
+bool raceWon(const HighsStatus return_status,
+             const HighsModelStatus model_status) {
+  if (return_status == HighsStatus::kError) return false;
+  return model_status == HighsModelStatus::kOptimal ||
+         model_status == HighsModelStatus::kInfeasible ||
+         model_status == HighsModelStatus::kUnboundedOrInfeasible ||
+         model_status == HighsModelStatus::kUnbounded ||
+         model_status == HighsModelStatus::kObjectiveBound ||
+         model_status == HighsModelStatus::kObjectiveTarget;
+}
+}  // namespace
+
+// Races dual simplex, primal simplex and IPX with crossover on
+// copies of the LP. The first solver to reach a conclusive model
+// status raises the interrupt flag of the others, and its basis,
+// solution and info are returned. Solvers that have not started when
+// the race is won are skipped, so with only one thread this reduces
+// to dual simplex
+HighsStatus solveLpConcurrent(HighsLpSolverObject& solver_object) {
+  HighsOptions& options = solver_object.options_;
+  const HighsInt kNumRacer = 3;
+  // Each solver has its own copy of the timer, so that it can start
+  // and stop clocks independently
+  std::unique_ptr<LpRacer> racer[kNumRacer];
+  for (HighsInt iRacer = 0; iRacer < kNumRacer; iRacer++) {
+    racer[iRacer].reset(new LpRacer(solver_object.timer_));
+    racer[iRacer]->lp = solver_object.lp_;
+    racer[iRacer]->basis = solver_object.basis_;
+    racer[iRacer]->solution = solver_object.solution_;
+    racer[iRacer]->highs_info = solver_object.highs_info_;
+    racer[iRacer]->options = options;
+    // Only dual simplex logs, so that output isn't interleaved
+    if (iRacer > 0) racer[iRacer]->options.output_flag = false;
+  }
+  racer[0]->name = "Dual simplex";
+  racer[0]->options.solver = kSimplexString;
+  racer[0]->options.simplex_strategy = kSimplexStrategyDual;
+  racer[1]->name = "Primal simplex";
+  racer[1]->options.solver = kSimplexString;
+  racer[1]->options.simplex_strategy = kSimplexStrategyPrimal;
+  racer[2]->name = "IPX";
+  racer[2]->options.solver = kIpmString;
+  racer[2]->options.run_crossover = true;
+
+  std::atomic<bool> interrupt{false};
+  std::atomic<HighsInt> winner{-1};
+  auto runRacer = [&](HighsInt iRacer) {
+    if (interrupt.load(std::memory_order_relaxed)) return;
+    LpRacer& this_racer = *racer[iRacer];
+    HighsLpSolverObject racer_object(
+        this_racer.lp, this_racer.basis, this_racer.solution,
+        this_racer.highs_info, this_racer.ekk_instance, this_racer.options,
+        this_racer.timer);
+    racer_object.interrupt_flag_ = &interrupt;
+    // Only dual simplex calls back, since it runs on the calling thread
+    if (iRacer == 0) racer_object.callback_ = solver_object.callback_;
+    this_racer.return_status =
+        solveLp(racer_object, this_racer.name + " in concurrent LP solve");
+    this_racer.model_status = racer_object.model_status_;
+    // A user interrupt stops the whole race
+    if (this_racer.model_status == HighsModelStatus::kInterrupt)
+      interrupt.store(true, std::memory_order_relaxed);
+    if (!raceWon(this_racer.return_status, this_racer.model_status)) return;
+    HighsInt no_winner = -1;
+    if (winner.compare_exchange_strong(no_winner, iRacer))
+      interrupt.store(true, std::memory_order_relaxed);
+  };
+
+  highs::parallel::TaskGroup tg;
+  for (HighsInt iRacer = kNumRacer - 1; iRacer > 0; iRacer--)
+    tg.spawn([&runRacer, iRacer]() { runRacer(iRacer); });
+  runRacer(0);
+  tg.taskWait();
+
+  HighsInt use_racer = winner.load(std::memory_order_relaxed);
+  if (use_racer < 0) {
+    // No solver has reached a conclusive model status, so use the
+    // first without an error
+    use_racer = 0;
+    for (HighsInt iRacer = 0; iRacer < kNumRacer; iRacer++) {
+      if (racer[iRacer]->return_status != HighsStatus::kError) {
+        use_racer = iRacer;
+        break;
+      }
+    }
+  } else {
+    highsLogUser(options.log_options, HighsLogType::kInfo,
+                 "%s finished first in concurrent LP solve\n",
+                 racer[use_racer]->name.c_str());
+  }
+  LpRacer& result = *racer[use_racer];
+  solver_object.basis_ = std::move(result.basis);
+  solver_object.solution_ = std::move(result.solution);
+  solver_object.highs_info_ = result.highs_info;
+  solver_object.model_status_ = result.model_status;
+  // The simplex instance of the caller hasn't been used, so its data
+  // don't correspond to the basis returned
+  solver_object.ekk_instance_.invalidate();
+  return result.return_status;
+}
+
 // Solves an unconstrained LP without scaling, setting HighsBasis, HighsSolution
 // and HighsInfo
 HighsStatus solveUnconstrainedLp(HighsLpSolverObject& solver_object) {
@@ -13,6 +13,8 @@
 
 #include "mip/HighsConflictPool.h"
 
+#include <algorithm>
+
 #include "mip/HighsDomain.h"
 
 void HighsConflictPool::addConflictCut(
@@ -159,6 +161,63 @@ void HighsConflictPool::addReconvergenceCut(
     conflictProp->conflictAdded(conflictIndex);
 }
 
+void HighsConflictPool::addConflicts(const HighsConflictPool& other) {
+  HighsInt numConflicts = other.conflictRanges_.size();
+  for (HighsInt k = 0; k != numConflicts; ++k) {
+    HighsInt otherStart = other.conflictRanges_[k].first;
+    HighsInt otherEnd = other.conflictRanges_[k].second;
+    // skip deleted conflicts
+    if (otherStart == -1) continue;
+
+    HighsInt conflictIndex;
+    HighsInt start;
+    HighsInt end;
+    HighsInt conflictLen = otherEnd - otherStart;
+    std::set<std::pair<HighsInt, HighsInt>>::iterator it;
+    if (freeSpaces_.empty() ||
+        (it = freeSpaces_.lower_bound(std::make_pair(
+             conflictLen, HighsInt{-1}))) == freeSpaces_.end()) {
+      start = conflictEntries_.size();
+      end = start + conflictLen;
+
+      conflictEntries_.resize(end);
+    } else {
+      std::pair<HighsInt, HighsInt> freeslot = *it;
+      freeSpaces_.erase(it);
+
+      start = freeslot.second;
+      end = start + conflictLen;
+      if (freeslot.first > conflictLen) {
+        freeSpaces_.emplace(freeslot.first - conflictLen, end);
+      }
+    }
+
+    if (deletedConflicts_.empty()) {
+      conflictIndex = conflictRanges_.size();
+      conflictRanges_.emplace_back(start, end);
+      ages_.resize(conflictRanges_.size());
+      modification_.resize(conflictRanges_.size());
+    } else {
+      conflictIndex = deletedConflicts_.back();
+      deletedConflicts_.pop_back();
+      conflictRanges_[conflictIndex].first = start;
+      conflictRanges_[conflictIndex].second = end;
+    }
+
+    modification_[conflictIndex] += 1;
+    ages_[conflictIndex] = 0;
+    ageDistribution_[ages_[conflictIndex]] += 1;
+
+    std::copy(other.conflictEntries_.begin() + otherStart,
+              other.conflictEntries_.begin() + otherEnd,
+              conflictEntries_.begin() + start);
+
+    for (HighsDomain::ConflictPoolPropagation* conflictProp :
+         propagationDomains)
+      conflictProp->conflictAdded(conflictIndex);
+  }
+}
+
 void HighsConflictPool::removeConflict(HighsInt conflict) {
   for (HighsDomain::ConflictPoolPropagation* conflictProp : propagationDomains)
     conflictProp->conflictDeleted(conflict);
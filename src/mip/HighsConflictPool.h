@@ -64,6 +64,9 @@ class HighsConflictPool {
           reconvergenceFrontier,
       const HighsDomainChange& reconvergenceDomchg);
 
+  /// adds copies of the conflicts stored in another pool for the same model
+  void addConflicts(const HighsConflictPool& other);
+
   void removeConflict(HighsInt conflict);
 
   void performAging();
@@ -2405,9 +2405,10 @@ bool HighsDomain::propagate() {
       for (HighsInt i = 0; i != numproprows; ++i) {
         HighsInt row = propagateinds[i];
         propagateflags_[row] = 0;
-        propnnz += mipsolver->mipdata_->ARstart_[i + 1] -
-                   mipsolver->mipdata_->ARstart_[i];
+        propnnz += mipsolver->mipdata_->ARstart_[row + 1] -
+                   mipsolver->mipdata_->ARstart_[row];
       }
+      mipsolver->mipdata_->addWorkTicks(propnnz);
 
       if (!infeasible_) {
         propRowNumChangedBounds_.assign(
@@ -2502,6 +2503,7 @@ bool HighsDomain::propagate() {
           propnnz += cutpoolprop.cutpool->getMatrix().getRowEnd(cut) -
                      cutpoolprop.cutpool->getMatrix().getRowStart(cut);
         }
+        mipsolver->mipdata_->addWorkTicks(propnnz);
 
         if (!infeasible_) {
           propRowNumChangedBounds_.assign(
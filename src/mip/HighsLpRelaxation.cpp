@@ -121,6 +121,8 @@ HighsLpRelaxation::HighsLpRelaxation(const HighsMipSolver& mipsolver)
   lastAgeCall = 0;
   objective = -kHighsInf;
   currentbasisstored = false;
+  lpSolvedAhead = false;
+  notifyCutPool = true;
   adjustSymBranchingCol = true;
 }
 
@@ -146,6 +148,8 @@ HighsLpRelaxation::HighsLpRelaxation(const HighsLpRelaxation& other)
   maxNumFractional = 0;
   lastAgeCall = 0;
   objective = -kHighsInf;
+  lpSolvedAhead = false;
+  notifyCutPool = true;
 }
 
 void HighsLpRelaxation::loadModel() {
@@ -163,12 +167,14 @@ void HighsLpRelaxation::loadModel() {
   lpsolver.passModel(std::move(lpmodel));
   colLbBuffer.resize(lpmodel.num_col_);
   colUbBuffer.resize(lpmodel.num_col_);
+  lpSolvedAhead = false;
 }
 
 void HighsLpRelaxation::resetToGlobalDomain() {
   lpsolver.changeColsBounds(0, mipsolver.numCol() - 1,
                             mipsolver.mipdata_->domain.col_lower_.data(),
                             mipsolver.mipdata_->domain.col_upper_.data());
+  lpSolvedAhead = false;
 }
 
 double HighsLpRelaxation::computeBestEstimate(const HighsPseudocost& ps) const {
@@ -260,6 +266,7 @@ void HighsLpRelaxation::addCuts(HighsCutSet& cutset) {
   if (numcuts > 0) {
     status = Status::kNotSet;
     currentbasisstored = false;
+    lpSolvedAhead = false;
     basischeckpoint.reset();
 
     lprows.reserve(lprows.size() + numcuts);
@@ -291,7 +298,8 @@ void HighsLpRelaxation::removeObsoleteRows(bool notifyPool) {
       if (ndelcuts == 0) deletemask.resize(nlprows);
       ++ndelcuts;
       deletemask[i] = 1;
-      if (notifyPool) mipsolver.mipdata_->cutpool.lpCutRemoved(lprows[i].index);
+      if (notifyPool && notifyCutPool)
+        mipsolver.mipdata_->cutpool.lpCutRemoved(lprows[i].index);
     }
   }
 
@@ -303,6 +311,7 @@ void HighsLpRelaxation::removeCuts(HighsInt ndelcuts,
   assert(lpsolver.getLp().num_row_ ==
          (HighsInt)lpsolver.getLp().row_lower_.size());
   if (ndelcuts > 0) {
+    lpSolvedAhead = false;
     HighsBasis basis = lpsolver.getBasis();
     HighsInt nlprows = lpsolver.getNumRow();
     lpsolver.deleteRows(deletemask.data());
@@ -332,10 +341,13 @@ void HighsLpRelaxation::removeCuts() {
   HighsInt nlprows = lpsolver.getNumRow();
   HighsInt modelrows = mipsolver.numRow();
 
+  lpSolvedAhead = false;
   lpsolver.deleteRows(modelrows, nlprows - 1);
-  for (HighsInt i = modelrows; i != nlprows; ++i) {
-    if (lprows[i].origin == LpRow::Origin::kCutPool)
-      mipsolver.mipdata_->cutpool.lpCutRemoved(lprows[i].index);
+  if (notifyCutPool) {
+    for (HighsInt i = modelrows; i != nlprows; ++i) {
+      if (lprows[i].origin == LpRow::Origin::kCutPool)
+        mipsolver.mipdata_->cutpool.lpCutRemoved(lprows[i].index);
+    }
   }
   lprows.resize(modelrows);
   assert(lpsolver.getLp().num_row_ ==
@@ -380,7 +392,8 @@ void HighsLpRelaxation::performAging(bool deleteRows) {
         if (ndelcuts == 0) deletemask.resize(nlprows);
         ++ndelcuts;
         deletemask[i] = 1;
-        mipsolver.mipdata_->cutpool.lpCutRemoved(lprows[i].index);
+        if (notifyCutPool)
+          mipsolver.mipdata_->cutpool.lpCutRemoved(lprows[i].index);
       }
     } else if (std::abs(lpsolver.getSolution().row_dual[i]) >
                lpsolver.getOptions().dual_feasibility_tolerance) {
@@ -419,6 +432,7 @@ void HighsLpRelaxation::flushDomain(HighsDomain& domain, bool continuous) {
     if (!continuous) domain.removeContinuousChangedCols();
     HighsInt numChgCols = domain.getChangedCols().size();
     if (numChgCols == 0) return;
+    lpSolvedAhead = false;
     const HighsInt* chgCols = domain.getChangedCols().data();
     for (HighsInt i = 0; i < numChgCols; ++i) {
       HighsInt col = chgCols[i];
@@ -709,6 +723,7 @@ bool HighsLpRelaxation::computeDualInfProof(const HighsDomain& globaldomain,
 
 void HighsLpRelaxation::recoverBasis() {
   if (basischeckpoint) {
+    lpSolvedAhead = false;
     lpsolver.setBasis(*basischeckpoint, "HighsLpRelaxation::recoverBasis");
     currentbasisstored = true;
   }
@@ -725,16 +740,40 @@ void HighsLpRelaxation::setObjectiveLimit(double objlim) {
   lpsolver.setOptionValue("objective_bound", objlim + offset);
 }
 
-HighsLpRelaxation::Status HighsLpRelaxation::run(bool resolve_on_error) {
+void HighsLpRelaxation::solveAhead() {
   lpsolver.setOptionValue(
       "time_limit", lpsolver.getRunTime() + mipsolver.options_mip_->time_limit -
                         mipsolver.timer_.read(mipsolver.timer_.solve_clock));
-  // lpsolver.setOptionValue("output_flag", true);
-  HighsStatus callstatus = lpsolver.run();
+  lpsolver.setOptionValue("work_limit",
+                          std::max(mipsolver.options_mip_->work_limit -
+                                       mipsolver.mipdata_->workUnits(),
+                                   0.0));
+  solvedAheadCallStatus = lpsolver.run();
+  lpSolvedAhead = true;
+}
+
+HighsLpRelaxation::Status HighsLpRelaxation::run(bool resolve_on_error) {
+  HighsStatus callstatus;
+  if (lpSolvedAhead) {
+    lpSolvedAhead = false;
+    callstatus = solvedAheadCallStatus;
+  } else {
+    lpsolver.setOptionValue(
+        "time_limit", lpsolver.getRunTime() +
+                          mipsolver.options_mip_->time_limit -
+                          mipsolver.timer_.read(mipsolver.timer_.solve_clock));
+    lpsolver.setOptionValue("work_limit",
+                            std::max(mipsolver.options_mip_->work_limit -
+                                         mipsolver.mipdata_->workUnits(),
+                                     0.0));
+    // lpsolver.setOptionValue("output_flag", true);
+    callstatus = lpsolver.run();
+  }
 
   const HighsInfo& info = lpsolver.getInfo();
   HighsInt itercount = std::max(HighsInt{0}, info.simplex_iteration_count);
   numlpiters += itercount;
+  mipsolver.mipdata_->addWorkUnits(info.work_units);
 
   if (callstatus == HighsStatus::kError) {
     lpsolver.clearSolver();
@@ -83,6 +83,9 @@ class HighsLpRelaxation {
   size_t epochs;
   HighsInt maxNumFractional;
   Status status;
+  HighsStatus solvedAheadCallStatus;
+  bool lpSolvedAhead;
+  bool notifyCutPool;
   bool adjustSymBranchingCol;
 
   void storeDualInfProof();
@@ -251,6 +254,12 @@ class HighsLpRelaxation {
     this->adjustSymBranchingCol = adjustSymBranchingCol;
   }
 
+  /// set to false if the cuts of this LP are held by another LP relaxation,
+  /// so that removing them does not release them in the cut pool
+  void setNotifyCutPool(bool notifyCutPool) {
+    this->notifyCutPool = notifyCutPool;
+  }
+
   void resetToGlobalDomain();
 
   double getAvgSolveIters() { return avgSolveIters; }
@@ -418,6 +427,12 @@ class HighsLpRelaxation {
 
   Status run(bool resolve_on_error = true);
 
+  /// solves the LP with its current bounds without processing the result, so
+  /// that it only touches data owned by this LP relaxation and may run
+  /// concurrently to other LP relaxations of the same MIP. The result is
+  /// consumed by the next call to run() unless the bounds are changed before.
+  void solveAhead();
+
   Highs& getLpSolver() { return lpsolver; }
   const Highs& getLpSolver() const { return lpsolver; }
 
@@ -12,6 +12,8 @@
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #include "mip/HighsMipSolver.h"
 
+#include <mutex>
+
 #include "lp_data/HighsLpUtils.h"
 #include "lp_data/HighsModelUtils.h"
 #include "mip/HighsCliqueTable.h"
@@ -37,11 +39,13 @@ HighsMipSolver::HighsMipSolver(const HighsOptions& options, const HighsLp& lp,
       model_(&lp),
       orig_model_(&lp),
       solution_objective_(kHighsInf),
+      work_units_(0),
       submip(submip),
       rootbasis(nullptr),
       pscostinit(nullptr),
       clqtableinit(nullptr),
-      implicinit(nullptr) {
+      implicinit(nullptr),
+      hotstart(nullptr) {
   if (solution.value_valid) {
     bound_violation_ = 0;
     row_violation_ = 0;
@@ -95,14 +99,119 @@ HighsMipSolver::HighsMipSolver(const HighsOptions& options, const HighsLp& lp,
 
 HighsMipSolver::~HighsMipSolver() = default;
 
+namespace {
+// Estimates the size of the search tree from the pruned tree weight and
+// decides whether the search is restarted from the root node
+struct TreeRestartCheck {
+  HighsInt numHugeTreeEstim;
+  int64_t numNodesLastCheck;
+  int64_t nextCheck;
+  double treeweightLastCheck;
+  double upperLimLastCheck;
+  double lowerBoundLastCheck;
+
+  TreeRestartCheck(const HighsMipSolverData& mipdata)
+      : numHugeTreeEstim(0),
+        numNodesLastCheck(mipdata.num_nodes),
+        nextCheck(mipdata.num_nodes),
+        treeweightLastCheck(0.0),
+        upperLimLastCheck(mipdata.upper_limit),
+        lowerBoundLastCheck(mipdata.lower_bound) {}
+
+  bool restartRequired(HighsMipSolverData& mipdata) {
+    if (mipdata.num_nodes < nextCheck) return false;
+
+    auto nTreeRestarts = mipdata.numRestarts - mipdata.numRestartsRoot;
+    double currNodeEstim =
+        numNodesLastCheck - mipdata.num_nodes_before_run +
+        (mipdata.num_nodes - numNodesLastCheck) *
+            double(1.0 - mipdata.pruned_treeweight) /
+            std::max(
+                double(mipdata.pruned_treeweight - treeweightLastCheck),
+                mipdata.epsilon);
+    // printf(
+    //     "nTreeRestarts: %d, numNodesThisRun: %ld, numNodesLastCheck: %ld,
+    //     " "currNodeEstim: %g, " "prunedTreeWeightDelta: %g,
+    //     numHugeTreeEstim: %d, numLeavesThisRun:
+    //     "
+    //     "%ld\n",
+    //     nTreeRestarts, mipdata.num_nodes -
+    //     mipdata.num_nodes_before_run, numNodesLastCheck -
+    //     mipdata.num_nodes_before_run, currNodeEstim, 100.0 *
+    //     double(mipdata.pruned_treeweight - treeweightLastCheck),
+    //     numHugeTreeEstim,
+    //     mipdata.num_leaves - mipdata.num_leaves_before_run);
+
+    bool doRestart = false;
+
+    double activeIntegerRatio =
+        1.0 - mipdata.percentageInactiveIntegers() / 100.0;
+    activeIntegerRatio *= activeIntegerRatio;
+
+    if (!doRestart) {
+      double gapReduction = 1.0;
+      if (mipdata.upper_limit != kHighsInf) {
+        double oldGap = upperLimLastCheck - lowerBoundLastCheck;
+        double newGap = mipdata.upper_limit - mipdata.lower_bound;
+        gapReduction = oldGap / newGap;
+      }
+
+      if (gapReduction < 1.0 + (0.05 / activeIntegerRatio) &&
+          currNodeEstim >=
+              activeIntegerRatio * 20 *
+                  (mipdata.num_nodes - mipdata.num_nodes_before_run)) {
+        nextCheck = mipdata.num_nodes + 100;
+        ++numHugeTreeEstim;
+      } else {
+        numHugeTreeEstim = 0;
+        treeweightLastCheck = double(mipdata.pruned_treeweight);
+        numNodesLastCheck = mipdata.num_nodes;
+        upperLimLastCheck = mipdata.upper_limit;
+        lowerBoundLastCheck = mipdata.lower_bound;
+      }
+
+      int64_t minHugeTreeOffset =
+          (mipdata.num_leaves - mipdata.num_leaves_before_run) * 1e-3;
+      int64_t minHugeTreeEstim = HighsIntegers::nearestInteger(
+          activeIntegerRatio * (10 + minHugeTreeOffset) *
+          std::pow(1.5, nTreeRestarts));
+
+      doRestart = numHugeTreeEstim >= minHugeTreeEstim;
+    } else {
+      // count restart due to many fixings within the first 1000 nodes as
+      // root restart
+      ++mipdata.numRestartsRoot;
+    }
+
+    return doRestart;
+  }
+};
+}  // namespace
+
 void HighsMipSolver::run() {
   modelstatus_ = HighsModelStatus::kNotset;
   // std::cout << options_mip_->presolve << std::endl;
   timer_.start(timer_.solve_clock);
 
+  if (hotstart) {
+    if (hotstart->root_basis.valid) rootbasis = &hotstart->root_basis;
+    pscostinit = hotstart->pscostinit.get();
+  }
+
   mipdata_ = decltype(mipdata_)(new HighsMipSolverData(*this));
   mipdata_->init();
   mipdata_->runPresolve();
+  if (modelstatus_ == HighsModelStatus::kNotset && callback_ &&
+      callback_->callbackActive(kCallbackPresolveComplete)) {
+    callback_->clearHighsCallbackDataOut();
+    callback_->data_out.running_time = timer_.readRunHighsClock();
+    callback_->data_out.presolved_num_col = numCol();
+    callback_->data_out.presolved_num_row = numRow();
+    callback_->data_out.presolved_num_nz = numNonzero();
+    if (callback_->callbackAction(kCallbackPresolveComplete,
+                                  "MIP presolve complete"))
+      modelstatus_ = HighsModelStatus::kInterrupt;
+  }
   if (modelstatus_ != HighsModelStatus::kNotset) {
     highsLogUser(options_mip_->log_options, HighsLogType::kInfo,
                  "Presolve: %s\n",
@@ -119,7 +228,10 @@ void HighsMipSolver::run() {
   mipdata_->runSetup();
 restart:
   if (modelstatus_ == HighsModelStatus::kNotset) {
+    std::unique_ptr<HighsMipSolverData::RootRacingData> racingData;
+    if (!submip) mipdata_->startRootRacing(racingData);
     mipdata_->evaluateRootNode();
+    mipdata_->finishRootRacing(racingData);
     // age 5 times to remove stored but never violated cuts after root
     // separation
     mipdata_->cutpool.performAging();
@@ -133,6 +245,18 @@ restart:
     return;
   }
 
+  if (options_mip_->mip_parallel_tree_search != kMipParallelTreeSearchOff &&
+      !submip) {
+    if (runParallelTreeSearch()) {
+      highsLogUser(options_mip_->log_options, HighsLogType::kInfo,
+                   "\nRestarting search from the root node\n");
+      mipdata_->performRestart();
+      goto restart;
+    }
+    cleanupSolve();
+    return;
+  }
+
   std::shared_ptr<const HighsBasis> basis;
   HighsSearch search{*this, mipdata_->pseudocost};
   mipdata_->debugSolution.registerDomain(search.getLocalDomain());
@@ -148,12 +272,7 @@ restart:
   int64_t numStallNodes = 0;
   int64_t lastLbLeave = 0;
   int64_t numQueueLeaves = 0;
-  HighsInt numHugeTreeEstim = 0;
-  int64_t numNodesLastCheck = mipdata_->num_nodes;
-  int64_t nextCheck = mipdata_->num_nodes;
-  double treeweightLastCheck = 0.0;
-  double upperLimLastCheck = mipdata_->upper_limit;
-  double lowerBoundLastCheck = mipdata_->lower_bound;
+  TreeRestartCheck restartCheck(*mipdata_);
   while (search.hasNode()) {
     mipdata_->conflictPool.performAging();
     // set iteration limit for each lp solve during the dive to 10 times the
@@ -274,75 +393,11 @@ restart:
       mipdata_->removeFixedIndices();
     }
 
-    if (!submip && mipdata_->num_nodes >= nextCheck) {
-      auto nTreeRestarts = mipdata_->numRestarts - mipdata_->numRestartsRoot;
-      double currNodeEstim =
-          numNodesLastCheck - mipdata_->num_nodes_before_run +
-          (mipdata_->num_nodes - numNodesLastCheck) *
-              double(1.0 - mipdata_->pruned_treeweight) /
-              std::max(
-                  double(mipdata_->pruned_treeweight - treeweightLastCheck),
-                  mipdata_->epsilon);
-      // printf(
-      //     "nTreeRestarts: %d, numNodesThisRun: %ld, numNodesLastCheck: %ld,
-      //     " "currNodeEstim: %g, " "prunedTreeWeightDelta: %g,
-      //     numHugeTreeEstim: %d, numLeavesThisRun:
-      //     "
-      //     "%ld\n",
-      //     nTreeRestarts, mipdata_->num_nodes -
-      //     mipdata_->num_nodes_before_run, numNodesLastCheck -
-      //     mipdata_->num_nodes_before_run, currNodeEstim, 100.0 *
-      //     double(mipdata_->pruned_treeweight - treeweightLastCheck),
-      //     numHugeTreeEstim,
-      //     mipdata_->num_leaves - mipdata_->num_leaves_before_run);
-
-      bool doRestart = false;
-
-      double activeIntegerRatio =
-          1.0 - mipdata_->percentageInactiveIntegers() / 100.0;
-      activeIntegerRatio *= activeIntegerRatio;
-
-      if (!doRestart) {
-        double gapReduction = 1.0;
-        if (mipdata_->upper_limit != kHighsInf) {
-          double oldGap = upperLimLastCheck - lowerBoundLastCheck;
-          double newGap = mipdata_->upper_limit - mipdata_->lower_bound;
-          gapReduction = oldGap / newGap;
-        }
-
-        if (gapReduction < 1.0 + (0.05 / activeIntegerRatio) &&
-            currNodeEstim >=
-                activeIntegerRatio * 20 *
-                    (mipdata_->num_nodes - mipdata_->num_nodes_before_run)) {
-          nextCheck = mipdata_->num_nodes + 100;
-          ++numHugeTreeEstim;
-        } else {
-          numHugeTreeEstim = 0;
-          treeweightLastCheck = double(mipdata_->pruned_treeweight);
-          numNodesLastCheck = mipdata_->num_nodes;
-          upperLimLastCheck = mipdata_->upper_limit;
-          lowerBoundLastCheck = mipdata_->lower_bound;
-        }
-
-        int64_t minHugeTreeOffset =
-            (mipdata_->num_leaves - mipdata_->num_leaves_before_run) * 1e-3;
-        int64_t minHugeTreeEstim = HighsIntegers::nearestInteger(
-            activeIntegerRatio * (10 + minHugeTreeOffset) *
-            std::pow(1.5, nTreeRestarts));
-
-        doRestart = numHugeTreeEstim >= minHugeTreeEstim;
-      } else {
-        // count restart due to many fixings within the first 1000 nodes as
-        // root restart
-        ++mipdata_->numRestartsRoot;
-      }
-
-      if (doRestart) {
-        highsLogUser(options_mip_->log_options, HighsLogType::kInfo,
-                     "\nRestarting search from the root node\n");
-        mipdata_->performRestart();
-        goto restart;
-      }
+    if (!submip && restartCheck.restartRequired(*mipdata_)) {
+      highsLogUser(options_mip_->log_options, HighsLogType::kInfo,
+                   "\nRestarting search from the root node\n");
+      mipdata_->performRestart();
+      goto restart;
     }
 
     // remove the iteration limit when installing a new node
@@ -472,6 +527,356 @@ restart:
   cleanupSolve();
 }
 
+namespace {
+// State of one worker of the parallel tree search. Each worker owns a copy of
+// the root LP relaxation and a search with its own local domain, so that the LP
+// solves of different workers can run concurrently.
+struct TreeSearchWorker {
+  HighsLpRelaxation lp;
+  HighsSearch search;
+  double plungeLowerBound;
+  HighsInt plungeNodes;
+  HighsInt domainEpoch;
+  bool considerHeuristics;
+  bool newDive;
+
+  TreeSearchWorker(HighsMipSolver& mipsolver)
+      : lp(mipsolver.mipdata_->lp),
+        search(mipsolver, mipsolver.mipdata_->pseudocost),
+        plungeLowerBound(-kHighsInf),
+        plungeNodes(0),
+        domainEpoch(0),
+        considerHeuristics(false),
+        newDive(false) {
+    // the cuts of the copied LP stay in the LP of the root node, which keeps
+    // them alive in the cut pool
+    lp.setNotifyCutPool(false);
+    search.setLpRelaxation(&lp);
+    mipsolver.mipdata_->debugSolution.registerDomain(search.getLocalDomain());
+  }
+};
+}  // namespace
+
+bool HighsMipSolver::runParallelTreeSearch() {
+  // The workers interleave their dives node by node. Everything that reads or
+  // modifies data shared between the workers, i.e. the node queue, the global
+  // domain, the cut and conflict pools and the incumbent, is done serially.
+  // Only the LP solves, which take the bulk of the time, run concurrently. In
+  // deterministic mode the workers proceed in rounds of one node each and the
+  // results of a round are processed in the order of the workers, so that the
+  // search does not depend on the timing of the threads. In opportunistic mode
+  // each worker processes its result as soon as its LP is solved.
+  const HighsInt numWorkers = highs::parallel::num_threads();
+  const bool deterministic = options_mip_->mip_parallel_tree_search ==
+                             kMipParallelTreeSearchDeterministic;
+
+  highsLogDev(options_mip_->log_options, HighsLogType::kInfo,
+              "starting %s parallel tree search with %" HIGHSINT_FORMAT
+              " workers\n",
+              deterministic ? "deterministic" : "opportunistic", numWorkers);
+
+  std::vector<std::unique_ptr<TreeSearchWorker>> workers;
+  workers.reserve(numWorkers);
+  for (HighsInt i = 0; i != numWorkers; ++i)
+    workers.emplace_back(new TreeSearchWorker(*this));
+
+  HighsInt domainEpoch = 0;
+  HighsInt numActive = 0;
+  int64_t lastLbLeave = 0;
+  int64_t numQueueLeaves = 0;
+  int64_t numStallNodes = 0;
+  TreeRestartCheck restartCheck(*mipdata_);
+  bool globalChangesPending = false;
+  bool restartPending = false;
+  bool stop = false;
+
+  auto updateLowerBound = [&]() {
+    double lb = mipdata_->nodequeue.getBestLowerBound();
+    for (const auto& w : workers)
+      if (w->search.hasNode()) lb = std::min(lb, w->plungeLowerBound);
+    mipdata_->lower_bound = std::min(mipdata_->upper_bound, lb);
+  };
+
+  auto endPlunge = [&](TreeSearchWorker& w) {
+    w.search.openNodesToQueue(mipdata_->nodequeue);
+    w.search.flushStatistics();
+  };
+
+  auto installNode = [&](TreeSearchWorker& w) {
+    if (stop || globalChangesPending || restartPending ||
+        mipdata_->nodequeue.empty())
+      return false;
+
+    if (w.domainEpoch != domainEpoch) {
+      w.search.resetLocalDomain();
+      w.domainEpoch = domainEpoch;
+    }
+
+    if (numQueueLeaves - lastLbLeave >= 10) {
+      w.search.installNode(mipdata_->nodequeue.popBestBoundNode());
+      lastLbLeave = numQueueLeaves;
+    } else {
+      HighsInt bestBoundNodeStackSize =
+          mipdata_->nodequeue.getBestBoundDomchgStackSize();
+      double bestBoundNodeLb = mipdata_->nodequeue.getBestLowerBound();
+      HighsNodeQueue::OpenNode nextNode(mipdata_->nodequeue.popBestNode());
+      if (nextNode.lower_bound == bestBoundNodeLb &&
+          nextNode.domchgstack.size() == bestBoundNodeStackSize)
+        lastLbLeave = numQueueLeaves;
+      w.search.installNode(std::move(nextNode));
+    }
+    ++numQueueLeaves;
+
+    if (w.search.getCurrentEstimate() >= mipdata_->upper_limit) {
+      ++numStallNodes;
+      if (options_mip_->mip_max_stall_nodes != kHighsIInf &&
+          numStallNodes >= options_mip_->mip_max_stall_nodes) {
+        modelstatus_ = HighsModelStatus::kIterationLimit;
+        stop = true;
+      }
+    } else
+      numStallNodes = 0;
+
+    HighsInt iterlimit =
+        10 * std::max(w.lp.getAvgSolveIters(), mipdata_->avgrootlpiters);
+    iterlimit = std::max({HighsInt{10000}, iterlimit,
+                          HighsInt(1.5 * mipdata_->firstrootlpiters)});
+    w.lp.setIterationLimit(iterlimit);
+
+    w.plungeLowerBound = w.search.getCurrentLowerBound();
+    w.plungeNodes = 0;
+    w.considerHeuristics = true;
+    w.newDive = true;
+    return true;
+  };
+
+  // evaluates the current node of the worker, whose LP may have been solved
+  // ahead, and proceeds with the dive as the serial search does
+  auto processNode = [&](TreeSearchWorker& w) {
+    if (w.considerHeuristics) {
+      w.considerHeuristics = false;
+      if (mipdata_->moreHeuristicsAllowed()) {
+        if (w.search.evaluateNode() == HighsSearch::NodeResult::kSubOptimal) {
+          endPlunge(w);
+          return;
+        }
+
+        if (w.search.currentNodePruned()) {
+          ++mipdata_->num_leaves;
+          w.search.flushStatistics();
+          if (!w.search.backtrackPlunge(mipdata_->nodequeue))
+            w.search.flushStatistics();
+          return;
+        }
+
+        const std::vector<double>& lpsol =
+            w.lp.getLpSolver().getSolution().col_value;
+        if (mipdata_->incumbent.empty())
+          mipdata_->heuristics.randomizedRounding(lpsol);
+
+        if (mipdata_->incumbent.empty())
+          mipdata_->heuristics.RENS(lpsol);
+        else
+          mipdata_->heuristics.RINS(lpsol);
+
+        mipdata_->heuristics.flushStatistics();
+        if (mipdata_->domain.infeasible()) return;
+      }
+    }
+
+    ++w.plungeNodes;
+    HighsSearch::NodeResult result = w.search.diveStep(w.newDive);
+    w.newDive = false;
+    if (result == HighsSearch::NodeResult::kBranched) {
+      if (w.plungeNodes >= 100) endPlunge(w);
+      return;
+    }
+
+    if (result == HighsSearch::NodeResult::kSubOptimal ||
+        !w.search.currentNodePruned()) {
+      endPlunge(w);
+      return;
+    }
+
+    ++mipdata_->num_leaves;
+    w.search.flushStatistics();
+    if (w.search.backtrackPlunge(mipdata_->nodequeue))
+      w.newDive = true;
+    else
+      w.search.flushStatistics();
+  };
+
+  // propagates the global domain and checks the limits and whether to restart.
+  // Global bound changes and restarts can only be applied once no worker has a
+  // node installed, hence they are marked as pending until then
+  auto synchronize = [&]() {
+    if (stop) return;
+    // conflicts may be the reasons for bound changes in the local domains of
+    // the workers, so while plunges are active they are only aged on exceeding
+    // the soft limit, as within a plunge of the serial search
+    if (numActive == 0 || mipdata_->conflictPool.getNumConflicts() >
+                              options_mip_->mip_pool_soft_limit)
+      mipdata_->conflictPool.performAging();
+    mipdata_->domain.propagate();
+    // the node queue derives global bounds from the open nodes it holds, which
+    // is only valid while no worker has open nodes of its own
+    if (numActive == 0)
+      mipdata_->pruned_treeweight += mipdata_->nodequeue.pruneInfeasibleNodes(
+          mipdata_->domain, mipdata_->feastol);
+
+    if (mipdata_->domain.infeasible()) {
+      stop = true;
+      return;
+    }
+
+    if (!mipdata_->domain.getChangedCols().empty())
+      globalChangesPending = true;
+
+    if (globalChangesPending && numActive == 0) {
+      highsLogDev(options_mip_->log_options, HighsLogType::kInfo,
+                  "added %" HIGHSINT_FORMAT " global bound changes\n",
+                  (HighsInt)mipdata_->domain.getChangedCols().size());
+      mipdata_->cliquetable.cleanupFixed(mipdata_->domain);
+      for (HighsInt col : mipdata_->domain.getChangedCols())
+        mipdata_->implications.cleanupVarbounds(col);
+
+      mipdata_->domain.setDomainChangeStack(std::vector<HighsDomainChange>());
+      mipdata_->domain.clearChangedCols();
+      mipdata_->removeFixedIndices();
+      globalChangesPending = false;
+      ++domainEpoch;
+    }
+
+    updateLowerBound();
+    mipdata_->printDisplayLine();
+
+    if (mipdata_->checkLimits())
+      stop = true;
+    else if (!restartPending && restartCheck.restartRequired(*mipdata_))
+      restartPending = true;
+  };
+
+  mipdata_->lower_bound = mipdata_->nodequeue.getBestLowerBound();
+  mipdata_->printDisplayLine();
+
+  if (deterministic) {
+    std::vector<TreeSearchWorker*> lpWorkers;
+    lpWorkers.reserve(numWorkers);
+    while (!stop) {
+      numActive = 0;
+      for (const auto& w : workers)
+        if (w->search.hasNode() || installNode(*w)) ++numActive;
+
+      if (numActive == 0) {
+        if (globalChangesPending && !restartPending &&
+            !mipdata_->nodequeue.empty()) {
+          synchronize();
+          continue;
+        }
+        break;
+      }
+
+      lpWorkers.clear();
+      for (const auto& w : workers)
+        if (w->search.hasNode() && w->search.prepareNodeLp())
+          lpWorkers.push_back(w.get());
+
+      highs::parallel::for_each(
+          0, (HighsInt)lpWorkers.size(), [&](HighsInt start, HighsInt end) {
+            for (HighsInt i = start; i < end; ++i) lpWorkers[i]->lp.solveAhead();
+          });
+
+      for (const auto& w : workers) {
+        if (!w->search.hasNode()) continue;
+        processNode(*w);
+        if (mipdata_->domain.infeasible()) break;
+      }
+
+      // a round ends the plunges of all workers once global bound changes
+      // or a restart are pending, so that they can be applied in the
+      // synchronization
+      numActive = 0;
+      for (const auto& w : workers) {
+        if (!w->search.hasNode()) continue;
+        if (globalChangesPending || restartPending ||
+            !mipdata_->domain.getChangedCols().empty())
+          endPlunge(*w);
+        else
+          ++numActive;
+      }
+
+      synchronize();
+    }
+  } else {
+    std::mutex mutex;
+
+    auto runWorker = [&](TreeSearchWorker& w) {
+      mutex.lock();
+      while (!stop) {
+        if (!w.search.hasNode()) {
+          if (!installNode(w)) {
+            if (numActive == 0 && (!globalChangesPending || restartPending))
+              break;
+            if (numActive == 0) {
+              synchronize();
+              continue;
+            }
+            mutex.unlock();
+            std::this_thread::yield();
+            mutex.lock();
+            continue;
+          }
+          ++numActive;
+        }
+
+        if (w.search.prepareNodeLp()) {
+          mutex.unlock();
+          w.lp.solveAhead();
+          mutex.lock();
+          if (stop) break;
+        }
+
+        processNode(w);
+
+        if (w.search.hasNode() &&
+            (globalChangesPending || restartPending ||
+             !mipdata_->domain.getChangedCols().empty()))
+          endPlunge(w);
+
+        if (!w.search.hasNode()) {
+          --numActive;
+          synchronize();
+        }
+      }
+      // the plunges of other workers may not be touched here, as their LP
+      // solves may still be running
+      endPlunge(w);
+      mutex.unlock();
+    };
+
+    highs::parallel::TaskGroup tg;
+    for (HighsInt i = 1; i < numWorkers; ++i)
+      tg.spawn([&runWorker, &workers, i]() { runWorker(*workers[i]); });
+    runWorker(*workers[0]);
+    tg.taskWait();
+  }
+
+  for (const auto& w : workers) endPlunge(*w);
+
+  if (mipdata_->domain.infeasible()) {
+    mipdata_->nodequeue.clear();
+    mipdata_->pruned_treeweight = 1.0;
+    mipdata_->lower_bound = std::min(kHighsInf, mipdata_->upper_bound);
+    mipdata_->printDisplayLine();
+    return false;
+  }
+
+  updateLowerBound();
+  mipdata_->printDisplayLine();
+
+  return restartPending && !stop && !mipdata_->nodequeue.empty();
+}
+
 void HighsMipSolver::cleanupSolve() {
   timer_.start(timer_.postsolve_clock);
   bool havesolution = solution_objective_ != kHighsInf;
@@ -487,6 +892,7 @@ void HighsMipSolver::cleanupSolve() {
   dual_bound_ += model_->offset_;
   primal_bound_ = mipdata_->upper_bound + model_->offset_;
   node_count_ = mipdata_->num_nodes;
+  work_units_ = mipdata_->workUnits();
   dual_bound_ = std::min(dual_bound_, primal_bound_);
 
   // adjust objective sense in case of maximization problem
@@ -589,6 +995,36 @@ void HighsMipSolver::cleanupSolve() {
                (long long unsigned)mipdata_->sb_lp_iterations,
                (long long unsigned)mipdata_->sepa_lp_iterations,
                (long long unsigned)mipdata_->heuristic_lp_iterations);
+  if (options_mip_->mip_node_queue_memory_limit != kHighsInf)
+    highsLogUser(options_mip_->log_options, HighsLogType::kInfo,
+                 "  Node queue        %.2f MB (peak memory)\n",
+                 mipdata_->nodequeue.getPeakMemoryUsage() / (1024.0 * 1024.0));
 
   assert(modelstatus_ != HighsModelStatus::kNotset);
 }
+
+void HighsMipSolver::saveHotStart(HighsMipHotStart& hotStart) const {
+  // keep the incumbent of an earlier solve if none was found
+  if (solution_objective_ != kHighsInf) hotStart.solution = solution_;
+  // the pseudocosts and root basis only exist if presolve did not
+  // finish the solve
+  if (!mipdata_ || numCol() == 0 ||
+      mipdata_->pseudocost.getNumCol() != numCol())
+    return;
+  hotStart.pscostinit.reset(new HighsPseudocostInitialization(
+      mipdata_->pseudocost, options_mip_->mip_pscost_minreliable,
+      mipdata_->postSolveStack));
+  mipdata_->getOrigRootBasis(hotStart.root_basis);
+}
+
+bool HighsMipHotStart::compatible(const HighsLp& lp) const {
+  if (!solution.empty() && HighsInt(solution.size()) != lp.num_col_)
+    return false;
+  if (root_basis.valid &&
+      (HighsInt(root_basis.col_status.size()) != lp.num_col_ ||
+       HighsInt(root_basis.row_status.size()) != lp.num_row_))
+    return false;
+  if (pscostinit && HighsInt(pscostinit->pseudocostup.size()) != lp.num_col_)
+    return false;
+  return true;
+}
@@ -13,15 +13,36 @@
 #ifndef MIP_HIGHS_MIP_SOLVER_H_
 #define MIP_HIGHS_MIP_SOLVER_H_
 
+#include <memory>
+
 #include "Highs.h"
 #include "lp_data/HighsOptions.h"
+#include "mip/HighsPseudocost.h"
 
 struct HighsMipSolverData;
 class HighsCutPool;
-struct HighsPseudocostInitialization;
 class HighsCliqueTable;
 class HighsImplications;
 
+// Data retained from a MIP solve to hot start the solve of the model
+// after its costs or bounds are changed. It is held in the space of
+// the original model, so it is independent of the presolve
+// reductions of either solve. Cuts, conflicts and cliques are not
+// retained: they are derived in the presolved space using dual
+// reductions and the objective cutoff, so changing the model can
+// invalidate any of them
+struct HighsMipHotStart {
+  // Incumbent of the solve, tried (and repaired) before the root
+  // heuristics
+  std::vector<double> solution;
+  // Basis of the root LP, used as an (alien) starting basis
+  HighsBasis root_basis;
+  // Pseudocosts, used to initialize those of the new solve
+  std::unique_ptr<HighsPseudocostInitialization> pscostinit;
+
+  bool compatible(const HighsLp& lp) const;
+};
+
 class HighsMipSolver {
  public:
   const HighsOptions* options_mip_;
@@ -37,17 +58,27 @@ class HighsMipSolver {
   double primal_bound_;
   double gap_;
   int64_t node_count_;
+  double work_units_;
 
   bool submip;
   const HighsBasis* rootbasis;
   const HighsPseudocostInitialization* pscostinit;
   const HighsCliqueTable* clqtableinit;
   const HighsImplications* implicinit;
+  // Data from a previous solve, if any: only set for the MIP solved
+  // by Highs when the mip_incremental option is on
+  const HighsMipHotStart* hotstart;
 
   std::unique_ptr<HighsMipSolverData> mipdata_;
 
+  // User callback, if any: only set for the MIP solved by Highs, not
+  // for sub-MIPs
+  HighsCallback* callback_ = nullptr;
+
   void run();
 
+  bool runParallelTreeSearch();
+
   HighsInt numCol() const { return model_->num_col_; }
 
   HighsInt numRow() const { return model_->num_row_; }
@@ -86,6 +117,7 @@ class HighsMipSolver {
 
   mutable HighsTimer timer_;
   void cleanupSolve();
+  void saveHotStart(HighsMipHotStart& hotStart) const;
 };
 
 #endif
@@ -12,6 +12,7 @@
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #include "mip/HighsMipSolverData.h"
 
+#include <limits>
 #include <random>
 
 #include "lp_data/HighsLpUtils.h"
@@ -212,6 +213,268 @@ void HighsMipSolverData::finishSymmetryDetection(
     globalOrbits = symmetries.computeStabilizerOrbits(domain);
 }
 
+void HighsMipSolverData::startRootHeuristics(
+    std::unique_ptr<RootHeuristicsData>& rootHeurData) {
+  // the main thread evaluates the root node, all other workers of the
+  // scheduler search for primal solutions
+  HighsInt numSubMips = highs::parallel::num_threads() - 1;
+  if (numSubMips <= 0) return;
+
+  rootHeurData = std::unique_ptr<RootHeuristicsData>(new RootHeuristicsData());
+  RootHeuristicsData& data = *rootHeurData;
+  data.subMips.resize(numSubMips);
+
+  // the sub-MIPs work on copies of the model with the current global bounds
+  // and do not use the clique table, implications or pseudocosts of this
+  // solver, since those are modified by the root node evaluation
+  for (HighsInt i = 0; i != numSubMips; ++i) {
+    RootHeuristicsData::SubMip& subMip = data.subMips[i];
+    subMip.model = *mipsolver.model_;
+    subMip.model.col_lower_ = domain.col_lower_;
+    subMip.model.col_upper_ = domain.col_upper_;
+    subMip.model.offset_ = 0;
+    // every second sub-MIP ignores the objective and only searches for a
+    // feasible solution
+    if (i % 2 == 1) subMip.model.col_cost_.assign(mipsolver.numCol(), 0.0);
+
+    HighsOptions& options = subMip.options;
+    options = *mipsolver.options_mip_;
+    options.output_flag = false;
+    options.random_seed = mipsolver.options_mip_->random_seed + i + 1;
+    options.mip_max_improving_sols = 1;
+    options.mip_detect_symmetry = false;
+    options.mip_heuristic_effort = 0.8;
+    options.presolve = "on";
+    options.time_limit -= mipsolver.timer_.read(mipsolver.timer_.solve_clock);
+    if (i % 2 == 0) options.objective_bound = upper_limit;
+
+    std::atomic<bool>& stop = data.stop;
+    subMip.callback.user_callback =
+        [&stop](int callback_type, const std::string& message,
+                const HighsCallbackDataOut* data_out,
+                HighsCallbackDataIn* data_in, void* user_callback_data) {
+          data_in->user_interrupt = stop.load(std::memory_order_relaxed);
+        };
+    subMip.callback.active[kCallbackMipNode] = true;
+    subMip.callback.active[kCallbackMipCutRound] = true;
+  }
+
+  for (HighsInt i = 0; i != numSubMips; ++i) {
+    data.taskGroup.spawn([&data, i]() {
+      if (data.stop.load(std::memory_order_relaxed)) return;
+      RootHeuristicsData::SubMip& subMip = data.subMips[i];
+      HighsSolution solution;
+      solution.value_valid = false;
+      solution.dual_valid = false;
+      HighsMipSolver submipsolver(subMip.options, subMip.model, solution, true);
+      submipsolver.callback_ = &subMip.callback;
+      submipsolver.run();
+      if (submipsolver.solution_.empty()) return;
+
+      std::lock_guard<std::mutex> lock(data.solutionMutex);
+      data.solutions.push_back(std::move(submipsolver.solution_));
+    });
+  }
+}
+
+void HighsMipSolverData::flushRootHeuristics(
+    std::unique_ptr<RootHeuristicsData>& rootHeurData) {
+  if (!rootHeurData) return;
+
+  std::vector<std::vector<double>> solutions;
+  {
+    std::lock_guard<std::mutex> lock(rootHeurData->solutionMutex);
+    solutions.swap(rootHeurData->solutions);
+  }
+
+  // the solutions are checked against the model of this solver, so that
+  // those of sub-MIPs that ignore the objective get their true objective
+  for (const std::vector<double>& solution : solutions)
+    trySolution(solution, 'L');
+}
+
+void HighsMipSolverData::finishRootHeuristics(
+    std::unique_ptr<RootHeuristicsData>& rootHeurData) {
+  if (!rootHeurData) return;
+
+  rootHeurData->stop = true;
+  rootHeurData->taskGroup.cancel();
+  rootHeurData->taskGroup.taskWait();
+  flushRootHeuristics(rootHeurData);
+  rootHeurData.reset();
+}
+
+void HighsMipSolverData::startRootRacing(
+    std::unique_ptr<RootRacingData>& racingData) {
+  // this solver evaluates the root node as the first racer
+  HighsInt numRacers = mipsolver.options_mip_->mip_root_racers - 1;
+  if (numRacers <= 0) return;
+
+  racingData = std::unique_ptr<RootRacingData>(new RootRacingData());
+  RootRacingData& data = *racingData;
+  data.numRestarts = numRestarts;
+  data.racers.resize(numRacers);
+
+  // the racers evaluate the root node of copies of the model with the current
+  // global bounds, and presolve is switched off so that their cuts, conflicts
+  // and bounds refer to the columns of this solver
+  for (HighsInt i = 0; i != numRacers; ++i) {
+    RootRacingData::Racer& racer = data.racers[i];
+    racer.model = *mipsolver.model_;
+    racer.model.col_lower_ = domain.col_lower_;
+    racer.model.col_upper_ = domain.col_upper_;
+    racer.model.offset_ = 0;
+
+    HighsOptions& options = racer.options;
+    options = *mipsolver.options_mip_;
+    options.output_flag = false;
+    options.random_seed = mipsolver.options_mip_->random_seed + i + 1;
+    options.presolve = kHighsOffString;
+    options.mip_root_racers = 1;
+    options.mip_max_nodes = 1;
+    // orbital fixings of different racers need not be compatible
+    options.mip_detect_symmetry = false;
+    options.mip_parallel_tree_search = kMipParallelTreeSearchOff;
+    options.mip_parallel_strong_branching = false;
+    options.mip_concurrent_root_heuristics = false;
+    options.time_limit -= mipsolver.timer_.read(mipsolver.timer_.solve_clock);
+    options.objective_bound = upper_limit;
+
+    // every second racer spends more effort on heuristics and keeps rows in
+    // the LP and the cutpool for longer, the others spend less
+    if (i % 2 == 0) {
+      options.mip_heuristic_effort =
+          std::min(1.0, 2.0 * options.mip_heuristic_effort);
+      options.mip_lp_age_limit =
+          std::min(HighsInt{std::numeric_limits<int16_t>::max()},
+                   2 * options.mip_lp_age_limit);
+      options.mip_pool_age_limit =
+          std::min(HighsInt{1000}, 2 * options.mip_pool_age_limit);
+    } else {
+      options.mip_heuristic_effort *= 0.5;
+      options.mip_lp_age_limit /= 2;
+      options.mip_pool_age_limit /= 2;
+    }
+
+    std::atomic<bool>& stop = data.stop;
+    racer.callback.user_callback =
+        [&stop](int callback_type, const std::string& message,
+                const HighsCallbackDataOut* data_out,
+                HighsCallbackDataIn* data_in, void* user_callback_data) {
+          data_in->user_interrupt = stop.load(std::memory_order_relaxed);
+        };
+    racer.callback.active[kCallbackMipNode] = true;
+    racer.callback.active[kCallbackMipCutRound] = true;
+
+    HighsSolution solution;
+    solution.value_valid = false;
+    solution.dual_valid = false;
+    racer.solver = std::unique_ptr<HighsMipSolver>(
+        new HighsMipSolver(options, racer.model, solution, false));
+    racer.solver->callback_ = &racer.callback;
+  }
+
+  for (HighsInt i = 0; i != numRacers; ++i) {
+    data.taskGroup.spawn([&data, i]() {
+      if (data.stop.load(std::memory_order_relaxed)) return;
+      data.racers[i].solver->run();
+    });
+  }
+}
+
+void HighsMipSolverData::finishRootRacing(
+    std::unique_ptr<RootRacingData>& racingData) {
+  if (!racingData) return;
+
+  RootRacingData& data = *racingData;
+  // the racers have nothing to contribute once the root node is solved
+  if (nodequeue.empty()) data.stop = true;
+  data.taskGroup.taskWait();
+
+  if (data.numRestarts != numRestarts || nodequeue.empty()) {
+    racingData.reset();
+    return;
+  }
+
+  // merge the results in the order of the racers, so that the search
+  // continues deterministically from the same state
+  std::vector<HighsInt> cutinds;
+  std::vector<double> cutvals;
+  const HighsPseudocost* bestPseudocost = nullptr;
+  double bestLowerBound = lower_bound;
+  for (const RootRacingData::Racer& racer : data.racers) {
+    const HighsMipSolver& racerSolver = *racer.solver;
+    // racers that were cancelled before they started have no data
+    if (!racerSolver.mipdata_) continue;
+    const HighsMipSolverData& racerData = *racerSolver.mipdata_;
+    if (racerSolver.numCol() != mipsolver.numCol()) continue;
+
+    if (!racerSolver.solution_.empty())
+      trySolution(racerSolver.solution_, 'L');
+
+    const HighsDynamicRowMatrix& cutMatrix = racerData.cutpool.getMatrix();
+    HighsInt numCuts = cutMatrix.getNumRows();
+    for (HighsInt cut = 0; cut != numCuts; ++cut) {
+      // skip deleted cuts
+      if (cutMatrix.getRowStart(cut) == -1) continue;
+
+      HighsInt cutlen;
+      const HighsInt* inds;
+      const double* vals;
+      racerData.cutpool.getCut(cut, cutlen, inds, vals);
+      cutinds.assign(inds, inds + cutlen);
+      cutvals.assign(vals, vals + cutlen);
+      cutpool.addCut(mipsolver, cutinds.data(), cutvals.data(), cutlen,
+                     racerData.cutpool.getRhs()[cut],
+                     racerData.cutpool.cutIsIntegral(cut));
+    }
+
+    conflictPool.addConflicts(racerData.conflictPool);
+
+    for (HighsInt i = 0; i != mipsolver.numCol(); ++i) {
+      if (racerData.domain.col_lower_[i] > domain.col_lower_[i])
+        domain.changeBound(HighsBoundType::kLower, i,
+                           racerData.domain.col_lower_[i],
+                           HighsDomain::Reason::unspecified());
+      if (domain.infeasible()) break;
+      if (racerData.domain.col_upper_[i] < domain.col_upper_[i])
+        domain.changeBound(HighsBoundType::kUpper, i,
+                           racerData.domain.col_upper_[i],
+                           HighsDomain::Reason::unspecified());
+      if (domain.infeasible()) break;
+    }
+
+    if (racerData.lower_bound > bestLowerBound) {
+      bestLowerBound = racerData.lower_bound;
+      bestPseudocost = &racerData.pseudocost;
+    }
+  }
+
+  // the search continues with the pseudocosts of the racer with the best
+  // dual bound
+  if (bestPseudocost) {
+    lower_bound = bestLowerBound;
+    pseudocost = *bestPseudocost;
+  }
+  racingData.reset();
+
+  nodequeue.clear();
+  HighsLpRelaxation::Status status = evaluateRootLp();
+  if (status == HighsLpRelaxation::Status::kInfeasible) return;
+
+  if (lower_bound > upper_limit) {
+    mipsolver.modelstatus_ = HighsModelStatus::kOptimal;
+    pruned_treeweight = 1.0;
+    num_nodes += 1;
+    num_leaves += 1;
+    return;
+  }
+
+  nodequeue.emplaceNode(std::vector<HighsDomainChange>(),
+                        std::vector<HighsInt>(), lower_bound,
+                        lp.computeBestEstimate(pseudocost), 1);
+}
+
 double HighsMipSolverData::computeNewUpperLimit(double ub, double mip_abs_gap,
                                                 double mip_rel_gap) const {
   double new_upper_limit;
@@ -374,6 +637,7 @@ void HighsMipSolverData::init() {
   sepa_lp_iterations_before_run = 0;
   sb_lp_iterations_before_run = 0;
   num_disp_lines = 0;
+  work_ticks = 0;
   numCliqueEntriesAfterPresolve = 0;
   numCliqueEntriesAfterFirstPresolve = 0;
   cliquesExtracted = false;
@@ -456,6 +720,8 @@ void HighsMipSolverData::runSetup() {
   pseudocost = HighsPseudocost(mipsolver);
   nodequeue.setNumCol(mipsolver.numCol());
   nodequeue.setOptimalityLimit(optimality_limit);
+  nodequeue.setMemoryLimit(mipsolver.options_mip_->mip_node_queue_memory_limit *
+                           1024 * 1024);
 
   continuous_cols.clear();
   integer_cols.clear();
@@ -804,27 +1070,11 @@ void HighsMipSolverData::performRestart() {
   presolvedModel.offset_ = offset;
   presolvedModel.integrality_ = std::move(integrality);
 
-  const HighsBasis& basis = firstrootbasis;
-  if (basis.valid) {
-    // if we have a basis after solving the root LP, we expand it to the
-    // original space so that it can be used for constructing a starting basis
-    // for the presolved model after the restart
-    root_basis.col_status.resize(postSolveStack.getOrigNumCol());
-    root_basis.row_status.resize(postSolveStack.getOrigNumRow(),
-                                 HighsBasisStatus::kBasic);
-    root_basis.valid = true;
-
-    for (HighsInt i = 0; i < mipsolver.model_->num_col_; ++i)
-      root_basis.col_status[postSolveStack.getOrigColIndex(i)] =
-          basis.col_status[i];
-
-    HighsInt numRow = basis.row_status.size();
-    for (HighsInt i = 0; i < numRow; ++i)
-      root_basis.row_status[postSolveStack.getOrigRowIndex(i)] =
-          basis.row_status[i];
-
-    mipsolver.rootbasis = &root_basis;
-  }
+  // if we have a basis after solving the root LP, we expand it to the
+  // original space so that it can be used for constructing a starting basis
+  // for the presolved model after the restart
+  getOrigRootBasis(root_basis);
+  if (root_basis.valid) mipsolver.rootbasis = &root_basis;
 
   // transform the objective upper bound into the original space, as it is
   // expected during presolve
@@ -889,6 +1139,28 @@ void HighsMipSolverData::basisTransfer() {
   }
 }
 
+void HighsMipSolverData::getOrigRootBasis(HighsBasis& root_basis) const {
+  const HighsBasis& basis = firstrootbasis;
+  if (!basis.valid) {
+    root_basis.invalidate();
+    return;
+  }
+  root_basis.col_status.assign(postSolveStack.getOrigNumCol(),
+                               HighsBasisStatus::kNonbasic);
+  root_basis.row_status.assign(postSolveStack.getOrigNumRow(),
+                               HighsBasisStatus::kBasic);
+  root_basis.valid = true;
+
+  for (HighsInt i = 0; i < mipsolver.model_->num_col_; ++i)
+    root_basis.col_status[postSolveStack.getOrigColIndex(i)] =
+        basis.col_status[i];
+
+  HighsInt numRow = basis.row_status.size();
+  for (HighsInt i = 0; i < numRow; ++i)
+    root_basis.row_status[postSolveStack.getOrigRowIndex(i)] =
+        basis.row_status[i];
+}
+
 const std::vector<double>& HighsMipSolverData::getSolution() const {
   return incumbent;
 }
@@ -926,6 +1198,8 @@ bool HighsMipSolverData::addIncumbent(const std::vector<double>& sol,
       }
       pruned_treeweight += nodequeue.performBounding(upper_limit);
       printDisplayLine(source);
+      interruptFromCallback(kCallbackMipImprovingSolution,
+                            "Improving solution");
     }
   } else if (incumbent.empty())
     incumbent = sol;
@@ -1206,7 +1480,15 @@ void HighsMipSolverData::evaluateRootNode() {
   HighsInt maxSepaRounds = mipsolver.submip ? 5 : kHighsIInf;
   std::unique_ptr<SymmetryDetectionData> symData;
   highs::parallel::TaskGroup tg;
+  // declared after the task group so that the sub-MIPs are stopped before
+  // the task group waits for its tasks on an early return
+  std::unique_ptr<RootHeuristicsData> rootHeurData;
 restart:
+  // spawned before the other root tasks, as those are synchronized in LIFO
+  // order
+  if (mipsolver.options_mip_->mip_concurrent_root_heuristics &&
+      !mipsolver.submip)
+    startRootHeuristics(rootHeurData);
   if (detectSymmetries) startSymmetryDetection(tg, symData);
   if (!analyticCenterComputed) startAnalyticCenterComputation(tg);
 
@@ -1282,6 +1564,19 @@ restart:
   // make sure first line after solving root LP is printed
   last_disptime = -kHighsInf;
 
+  // before the other heuristics, try the incumbent of the solve that is
+  // hot started from: its integer values are clipped into the current
+  // domain and the continuous values are recomputed, which repairs it if
+  // the changes to the model have cut it off
+  if (numRestarts == 0 && mipsolver.hotstart &&
+      !mipsolver.hotstart->solution.empty()) {
+    std::vector<double> point =
+        postSolveStack.getReducedPrimalSolution(mipsolver.hotstart->solution);
+    for (HighsInt col : integral_cols)
+      point[col] = std::floor(point[col] + 0.5);
+    heuristics.tryRoundedPoint(point, 'I');
+  }
+
   heuristics.randomizedRounding(firstlpsol);
   heuristics.flushStatistics();
 
@@ -1325,6 +1620,10 @@ restart:
 
     HighsInt ncuts;
     if (rootSeparationRound(sepa, ncuts, status)) return;
+    if (interruptFromCallback(kCallbackMipCutRound, "MIP cut round",
+                              nseparounds))
+      return;
+    flushRootHeuristics(rootHeurData);
     if (nseparounds >= 5 && !mipsolver.submip && !analyticCenterComputed) {
       if (checkLimits()) return;
       finishAnalyticCenterComputation(tg);
@@ -1509,6 +1808,8 @@ restart:
                      "\n%.1f%% inactive integer columns, restarting\n",
                      fixingRate);
         if (stall != -1) maxSepaRounds = std::min(maxSepaRounds, nseparounds);
+        // solutions of the sub-MIPs refer to the model before the restart
+        finishRootHeuristics(rootHeurData);
         tg.taskWait();
         performRestart();
         ++numRestartsRoot;
@@ -1524,6 +1825,17 @@ restart:
       if (status == HighsLpRelaxation::Status::kInfeasible) return;
     }
 
+    if (rootHeurData) {
+      finishRootHeuristics(rootHeurData);
+      if (lower_bound > upper_limit) {
+        mipsolver.modelstatus_ = HighsModelStatus::kOptimal;
+        pruned_treeweight = 1.0;
+        num_nodes += 1;
+        num_leaves += 1;
+        return;
+      }
+    }
+
     // add the root node to the nodequeue to initialize the search
     nodequeue.emplaceNode(std::vector<HighsDomainChange>(),
                           std::vector<HighsInt>(), lower_bound,
@@ -1534,6 +1846,9 @@ restart:
 bool HighsMipSolverData::checkLimits(int64_t nodeOffset) const {
   const HighsOptions& options = *mipsolver.options_mip_;
 
+  // The user may have interrupted the solve from any callback
+  if (mipsolver.modelstatus_ == HighsModelStatus::kInterrupt) return true;
+
   if (options.mip_max_nodes != kHighsIInf &&
       num_nodes + nodeOffset >= options.mip_max_nodes) {
     if (mipsolver.modelstatus_ == HighsModelStatus::kNotset) {
@@ -1573,9 +1888,69 @@ bool HighsMipSolverData::checkLimits(int64_t nodeOffset) const {
     return true;
   }
 
+  if (workUnits() >= options.work_limit) {
+    if (mipsolver.modelstatus_ == HighsModelStatus::kNotset) {
+      highsLogDev(options.log_options, HighsLogType::kInfo,
+                  "reached work limit\n");
+      mipsolver.modelstatus_ = HighsModelStatus::kTimeLimit;
+    }
+    return true;
+  }
+
+  if (interruptFromCallback(kCallbackMipNode, "MIP node")) return true;
+
   return false;
 }
 
+bool HighsMipSolverData::interruptFromCallback(const int callback_type,
+                                               const std::string& message,
+                                               const HighsInt cut_round) const {
+  HighsCallback* callback = mipsolver.callback_;
+  if (!callback || !callback->callbackActive(callback_type)) return false;
+  assert(!mipsolver.submip);
+  // Once the user has interrupted, just wait for the solver to stop
+  if (mipsolver.modelstatus_ == HighsModelStatus::kInterrupt) return true;
+
+  // Bounds and gap are reported for the original objective, as in
+  // HighsMipSolver::cleanupSolve()
+  const double offset = mipsolver.model_->offset_;
+  double dual_bound = std::min(lower_bound, upper_bound) + offset;
+  double primal_bound = upper_bound + offset;
+  double gap;
+  if (primal_bound == 0.0)
+    gap = dual_bound == 0.0 ? 0.0 : kHighsInf;
+  else if (primal_bound != kHighsInf)
+    gap = std::fabs(primal_bound - dual_bound) / std::fabs(primal_bound);
+  else
+    gap = kHighsInf;
+  if (mipsolver.orig_model_->sense_ == ObjSense::kMaximize) {
+    dual_bound = -dual_bound;
+    primal_bound = -primal_bound;
+  }
+
+  callback->clearHighsCallbackDataOut();
+  callback->data_out.running_time = mipsolver.timer_.readRunHighsClock();
+  callback->data_out.objective_function_value = mipsolver.solution_objective_;
+  callback->data_out.mip_node_count = num_nodes;
+  callback->data_out.mip_primal_bound = primal_bound;
+  callback->data_out.mip_dual_bound = dual_bound;
+  callback->data_out.mip_gap = gap;
+  callback->data_out.mip_cut_round = cut_round;
+  if (callback_type == kCallbackMipImprovingSolution) {
+    // The incumbent in the original space
+    callback->data_out.mip_solution_size = mipsolver.solution_.size();
+    callback->data_out.mip_solution = mipsolver.solution_.data();
+  }
+  if (!callback->callbackAction(callback_type, message)) return false;
+
+  if (mipsolver.modelstatus_ == HighsModelStatus::kNotset) {
+    highsLogDev(mipsolver.options_mip_->log_options, HighsLogType::kInfo,
+                "interrupted by user callback\n");
+    mipsolver.modelstatus_ = HighsModelStatus::kInterrupt;
+  }
+  return true;
+}
+
 void HighsMipSolverData::checkObjIntegrality() {
   objectiveFunction.checkIntegrality(epsilon);
   if (objectiveFunction.isIntegral() && numRestarts == 0) {
@@ -14,8 +14,12 @@
 #ifndef HIGHS_MIP_SOLVER_DATA_H_
 #define HIGHS_MIP_SOLVER_DATA_H_
 
+#include <atomic>
+#include <cmath>
+#include <mutex>
 #include <vector>
 
+#include "lp_data/HighsCallback.h"
 #include "mip/HighsCliqueTable.h"
 #include "mip/HighsConflictPool.h"
 #include "mip/HighsCutPool.h"
@@ -103,6 +107,11 @@ struct HighsMipSolverData {
   int64_t sepa_lp_iterations_before_run;
   int64_t sb_lp_iterations_before_run;
   int64_t num_disp_lines;
+  // Deterministic work of the solve in synthetic ticks. LPs are solved
+  // and domains propagated concurrently, so the ticks are accumulated
+  // atomically as integers to make the total independent of the order
+  // of the updates
+  std::atomic<int64_t> work_ticks;
 
   HighsInt numImprovingSols;
   double lower_bound;
@@ -149,6 +158,56 @@ struct HighsMipSolverData {
   void finishSymmetryDetection(const highs::parallel::TaskGroup& taskGroup,
                                std::unique_ptr<SymmetryDetectionData>& symData);
 
+  struct RootHeuristicsData {
+    struct SubMip {
+      HighsLp model;
+      HighsOptions options;
+      HighsCallback callback;
+    };
+
+    // constructed before the tasks are spawned, so that waiting for the
+    // group also waits for every sub-MIP
+    highs::parallel::TaskGroup taskGroup;
+    std::vector<SubMip> subMips;
+    std::atomic<bool> stop{false};
+    std::mutex solutionMutex;
+    std::vector<std::vector<double>> solutions;
+
+    ~RootHeuristicsData() {
+      stop = true;
+      taskGroup.cancel();
+      taskGroup.taskWait();
+    }
+  };
+
+  void startRootHeuristics(std::unique_ptr<RootHeuristicsData>& rootHeurData);
+  void flushRootHeuristics(std::unique_ptr<RootHeuristicsData>& rootHeurData);
+  void finishRootHeuristics(std::unique_ptr<RootHeuristicsData>& rootHeurData);
+
+  struct RootRacingData {
+    struct Racer {
+      HighsLp model;
+      HighsOptions options;
+      HighsCallback callback;
+      std::unique_ptr<HighsMipSolver> solver;
+    };
+
+    highs::parallel::TaskGroup taskGroup;
+    std::vector<Racer> racers;
+    std::atomic<bool> stop{false};
+    // the racers refer to the model before any restart of this solver
+    HighsInt numRestarts;
+
+    ~RootRacingData() {
+      stop = true;
+      taskGroup.cancel();
+      taskGroup.taskWait();
+    }
+  };
+
+  void startRootRacing(std::unique_ptr<RootRacingData>& racingData);
+  void finishRootRacing(std::unique_ptr<RootRacingData>& racingData);
+
   double computeNewUpperLimit(double upper_bound, double mip_abs_gap,
                               double mip_rel_gap) const;
   bool moreHeuristicsAllowed();
@@ -171,6 +230,8 @@ struct HighsMipSolverData {
   bool addIncumbent(const std::vector<double>& sol, double solobj, char source);
 
   const std::vector<double>& getSolution() const;
+  // Expands the basis of the root LP to the space of the original model
+  void getOrigRootBasis(HighsBasis& root_basis) const;
 
   void printDisplayLine(char first = ' ');
 
@@ -183,6 +244,23 @@ struct HighsMipSolverData {
   }
 
   bool checkLimits(int64_t nodeOffset = 0) const;
+  void addWorkTicks(int64_t ticks) {
+    work_ticks.fetch_add(ticks, std::memory_order_relaxed);
+  }
+  void addWorkUnits(double work_units) {
+    if (work_units > 0)
+      addWorkTicks(std::llround(work_units / kHighsWorkUnitsPerTick));
+  }
+  double workUnits() const {
+    return kHighsWorkUnitsPerTick *
+           work_ticks.load(std::memory_order_relaxed);
+  }
+
+  // Calls any active user callback of the given type, returning true
+  // and setting the model status if the user interrupts the solve
+  bool interruptFromCallback(const int callback_type,
+                             const std::string& message,
+                             const HighsInt cut_round = -1) const;
 };
 
 #endif
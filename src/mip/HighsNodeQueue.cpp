@@ -13,6 +13,8 @@
 #include "mip/HighsNodeQueue.h"
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <tuple>
 
 #include "lp_data/HConst.h"
@@ -46,6 +48,111 @@ struct RbTreeTraits<HighsNodeQueue::SuboptimalNodeRbTree> {
 
 using namespace highs;
 
+namespace {
+// approximate size of an entry in the column sets of the node queue, the
+// stored pair plus the links and color of the tree node
+constexpr int64_t kNodeSetEntrySize =
+    sizeof(std::pair<double, int64_t>) + 4 * sizeof(void*);
+
+// spilled nodes are read back once the memory usage drops below this fraction
+// of the limit, so that nodes do not move back and forth across the limit
+constexpr double kRestoreFraction = 0.75;
+
+// bound values that are integers below this magnitude are stored as varints
+constexpr double kMaxVarintBoundVal = 4503599627370496.0;
+
+void putVarint(std::vector<uint8_t>& buffer, uint64_t val) {
+  while (val >= 0x80) {
+    buffer.push_back(uint8_t(val) | 0x80);
+    val >>= 7;
+  }
+  buffer.push_back(uint8_t(val));
+}
+
+uint64_t getVarint(const uint8_t*& pos) {
+  uint64_t val = 0;
+  int shift = 0;
+  while (*pos & 0x80) {
+    val |= uint64_t(*pos++ & 0x7f) << shift;
+    shift += 7;
+  }
+  val |= uint64_t(*pos++) << shift;
+  return val;
+}
+
+uint64_t zigzagEncode(int64_t val) {
+  return (uint64_t(val) << 1) ^ uint64_t(val >> 63);
+}
+
+int64_t zigzagDecode(uint64_t val) {
+  return int64_t(val >> 1) ^ -int64_t(val & 1);
+}
+
+// Encodes the domain changes of a node as varints. Along the path from the
+// root, the columns are stored as differences to the previous domain change
+// and integral bound values as integers, which takes a few bytes for most
+// domain changes instead of sizeof(HighsDomainChange).
+void encodeNode(const std::vector<HighsDomainChange>& domchgstack,
+                const std::vector<HighsInt>& branchings,
+                std::vector<uint8_t>& buffer) {
+  buffer.clear();
+  putVarint(buffer, domchgstack.size());
+  HighsInt prevCol = 0;
+  for (const HighsDomainChange& domchg : domchgstack) {
+    bool integral = std::abs(domchg.boundval) < kMaxVarintBoundVal &&
+                    domchg.boundval == std::floor(domchg.boundval);
+    uint64_t upper = domchg.boundtype == HighsBoundType::kUpper;
+    putVarint(buffer,
+              (zigzagEncode(int64_t{domchg.column} - prevCol) << 2) |
+                  (upper << 1) | uint64_t{integral});
+    prevCol = domchg.column;
+    if (integral) {
+      putVarint(buffer, zigzagEncode(int64_t(domchg.boundval)));
+    } else {
+      size_t pos = buffer.size();
+      buffer.resize(pos + sizeof(double));
+      std::memcpy(&buffer[pos], &domchg.boundval, sizeof(double));
+    }
+  }
+
+  putVarint(buffer, branchings.size());
+  HighsInt prevPos = 0;
+  for (HighsInt branchPos : branchings) {
+    putVarint(buffer, zigzagEncode(int64_t{branchPos} - prevPos));
+    prevPos = branchPos;
+  }
+}
+
+void decodeNode(const std::vector<uint8_t>& buffer,
+                std::vector<HighsDomainChange>& domchgstack,
+                std::vector<HighsInt>& branchings) {
+  const uint8_t* pos = buffer.data();
+  domchgstack.resize(getVarint(pos));
+  HighsInt col = 0;
+  for (HighsDomainChange& domchg : domchgstack) {
+    uint64_t header = getVarint(pos);
+    col += HighsInt(zigzagDecode(header >> 2));
+    domchg.column = col;
+    domchg.boundtype =
+        header & 2 ? HighsBoundType::kUpper : HighsBoundType::kLower;
+    if (header & 1) {
+      domchg.boundval = double(zigzagDecode(getVarint(pos)));
+    } else {
+      std::memcpy(&domchg.boundval, pos, sizeof(double));
+      pos += sizeof(double);
+    }
+  }
+
+  branchings.resize(getVarint(pos));
+  HighsInt branchPos = 0;
+  for (HighsInt& branching : branchings) {
+    branchPos += HighsInt(zigzagDecode(getVarint(pos)));
+    branching = branchPos;
+  }
+  assert(pos == buffer.data() + buffer.size());
+}
+}  // namespace
+
 class HighsNodeQueue::NodeLowerRbTree : public CacheMinRbTree<NodeLowerRbTree> {
   HighsNodeQueue* nodeQueue;
 
@@ -63,7 +170,7 @@ class HighsNodeQueue::NodeLowerRbTree : public CacheMinRbTree<NodeLowerRbTree> {
   }
   std::tuple<double, HighsInt, double, int64_t> getKey(HighsInt node) const {
     return std::make_tuple(nodeQueue->nodes[node].lower_bound,
-                           HighsInt(nodeQueue->nodes[node].domchgstack.size()),
+                           nodeQueue->nodes[node].domchgStackSize,
                            nodeQueue->nodes[node].estimate, node);
   }
 };
@@ -89,7 +196,7 @@ class HighsNodeQueue::NodeHybridEstimRbTree
     constexpr double kEstimWeight = 0.5;
     return std::make_tuple(kLbWeight * nodeQueue->nodes[node].lower_bound +
                                kEstimWeight * nodeQueue->nodes[node].estimate,
-                           -HighsInt(nodeQueue->nodes[node].domchgstack.size()),
+                           -nodeQueue->nodes[node].domchgStackSize,
                            node);
   }
 };
@@ -156,6 +263,23 @@ void HighsNodeQueue::unlink_suboptimal(int64_t node) {
 
 void HighsNodeQueue::link_domchgs(int64_t node) {
   assert(node != -1);
+  if (nodes[node].storage == Storage::kCompressed) {
+    // compressed nodes do not keep the iterators and are unlinked by value
+    std::vector<HighsDomainChange> domchgstack;
+    std::vector<HighsInt> branchings;
+    decodeNode(nodes[node].compressed, domchgstack, branchings);
+    for (const HighsDomainChange& domchg : domchgstack) {
+      switch (domchg.boundtype) {
+        case HighsBoundType::kLower:
+          colLowerNodesPtr.get()[domchg.column].emplace(domchg.boundval, node);
+          break;
+        case HighsBoundType::kUpper:
+          colUpperNodesPtr.get()[domchg.column].emplace(domchg.boundval, node);
+      }
+    }
+    return;
+  }
+
   HighsInt numchgs = nodes[node].domchgstack.size();
   nodes[node].domchglinks.resize(numchgs);
 
@@ -176,6 +300,30 @@ void HighsNodeQueue::link_domchgs(int64_t node) {
 
 void HighsNodeQueue::unlink_domchgs(int64_t node) {
   assert(node != -1);
+  switch (nodes[node].storage) {
+    case Storage::kPlain:
+      break;
+    case Storage::kCompressed: {
+      std::vector<HighsDomainChange> domchgstack;
+      std::vector<HighsInt> branchings;
+      decodeNode(nodes[node].compressed, domchgstack, branchings);
+      for (const HighsDomainChange& domchg : domchgstack) {
+        std::pair<double, int64_t> key(domchg.boundval, node);
+        switch (domchg.boundtype) {
+          case HighsBoundType::kLower:
+            colLowerNodesPtr.get()[domchg.column].erase(key);
+            break;
+          case HighsBoundType::kUpper:
+            colUpperNodesPtr.get()[domchg.column].erase(key);
+        }
+      }
+      return;
+    }
+    case Storage::kSpilled:
+      // spilled nodes are not linked
+      return;
+  }
+
   HighsInt numchgs = nodes[node].domchgstack.size();
 
   for (HighsInt i = 0; i != numchgs; ++i) {
@@ -194,21 +342,26 @@ void HighsNodeQueue::unlink_domchgs(int64_t node) {
 }
 
 double HighsNodeQueue::link(int64_t node) {
+  double treeweight = 0.0;
   if (nodes[node].lower_bound > optimality_limit) {
     assert(nodes[node].estimate != kHighsInf);
     nodes[node].estimate = kHighsInf;
     link_suboptimal(node);
-    link_domchgs(node);
-    return std::ldexp(1.0, 1 - nodes[node].depth);
+    treeweight = std::ldexp(1.0, 1 - nodes[node].depth);
+  } else {
+    link_estim(node);
+    link_lower(node);
   }
 
-  link_estim(node);
-  link_lower(node);
   link_domchgs(node);
-  return 0.0;
+  memoryUsage += nodeMemory(node);
+  trackStorage(node);
+  return treeweight;
 }
 
 void HighsNodeQueue::unlink(int64_t node) {
+  memoryUsage -= nodeMemory(node);
+  untrackStorage(node);
   if (nodes[node].estimate == kHighsInf) {
     unlink_suboptimal(node);
   } else {
@@ -237,6 +390,172 @@ void HighsNodeQueue::setNumCol(HighsInt numCol) {
   }
 }
 
+void HighsNodeQueue::setMemoryLimit(double memoryLimit) {
+  if (this->memoryLimit == memoryLimit) return;
+  assert(numNodes() == 0);
+  this->memoryLimit = memoryLimit;
+  // without a spill file the nodes above the limit are only compressed
+  if (memoryLimit != kHighsInf)
+    spillFile = SpillFile(std::tmpfile());
+  else
+    spillFile.reset();
+}
+
+int64_t HighsNodeQueue::nodeMemory(int64_t node) const {
+  const OpenNode& openNode = nodes[node];
+  switch (openNode.storage) {
+    case Storage::kPlain:
+      return openNode.domchgstack.capacity() * sizeof(HighsDomainChange) +
+             openNode.branchings.capacity() * sizeof(HighsInt) +
+             openNode.domchglinks.capacity() * sizeof(NodeSet::iterator) +
+             openNode.domchgStackSize * kNodeSetEntrySize;
+    case Storage::kCompressed:
+      return openNode.compressed.capacity() +
+             openNode.domchgStackSize * kNodeSetEntrySize;
+    case Storage::kSpilled:
+      break;
+  }
+
+  return 0;
+}
+
+void HighsNodeQueue::trackStorage(int64_t node) {
+  if (memoryLimit == kHighsInf) return;
+  std::pair<double, int64_t> key(nodes[node].lower_bound, node);
+  switch (nodes[node].storage) {
+    case Storage::kPlain:
+      plainNodes.insert(key);
+      break;
+    case Storage::kCompressed:
+      compressedNodes.insert(key);
+      ++numCompressed;
+      break;
+    case Storage::kSpilled:
+      spilledNodes.insert(key);
+      ++numSpilled;
+  }
+}
+
+void HighsNodeQueue::untrackStorage(int64_t node) {
+  if (memoryLimit == kHighsInf) return;
+  std::pair<double, int64_t> key(nodes[node].lower_bound, node);
+  switch (nodes[node].storage) {
+    case Storage::kPlain:
+      plainNodes.erase(key);
+      break;
+    case Storage::kCompressed:
+      compressedNodes.erase(key);
+      --numCompressed;
+      break;
+    case Storage::kSpilled:
+      spilledNodes.erase(key);
+      --numSpilled;
+      // the spill file is reused from the start once it holds no open node
+      if (spilledNodes.empty()) spillFileEnd = 0;
+  }
+}
+
+void HighsNodeQueue::compressNode(int64_t node) {
+  OpenNode& openNode = nodes[node];
+  assert(openNode.storage == Storage::kPlain);
+  untrackStorage(node);
+  memoryUsage -= nodeMemory(node);
+
+  encodeNode(openNode.domchgstack, openNode.branchings, openNode.compressed);
+  openNode.compressed.shrink_to_fit();
+  std::vector<HighsDomainChange>().swap(openNode.domchgstack);
+  std::vector<HighsInt>().swap(openNode.branchings);
+  std::vector<NodeSet::iterator>().swap(openNode.domchglinks);
+  openNode.storage = Storage::kCompressed;
+
+  memoryUsage += nodeMemory(node);
+  trackStorage(node);
+}
+
+void HighsNodeQueue::spillNode(int64_t node) {
+  OpenNode& openNode = nodes[node];
+  assert(openNode.storage == Storage::kCompressed);
+  size_t size = openNode.compressed.size();
+  if (std::fseek(spillFile.get(), spillFileEnd, SEEK_SET) != 0 ||
+      std::fwrite(openNode.compressed.data(), 1, size, spillFile.get()) !=
+          size) {
+    // keep the node compressed and do not try to spill again
+    spillFile.reset();
+    return;
+  }
+
+  untrackStorage(node);
+  memoryUsage -= nodeMemory(node);
+  unlink_domchgs(node);
+
+  openNode.spillOffset = spillFileEnd;
+  openNode.spillSize = size;
+  spillFileEnd += size;
+  std::vector<uint8_t>().swap(openNode.compressed);
+  openNode.storage = Storage::kSpilled;
+
+  memoryUsage += nodeMemory(node);
+  trackStorage(node);
+}
+
+void HighsNodeQueue::readSpilledNode(int64_t node) {
+  OpenNode& openNode = nodes[node];
+  assert(openNode.storage == Storage::kSpilled);
+  openNode.compressed.resize(openNode.spillSize);
+  bool readOk =
+      std::fseek(spillFile.get(), openNode.spillOffset, SEEK_SET) == 0 &&
+      std::fread(openNode.compressed.data(), 1, openNode.spillSize,
+                 spillFile.get()) == size_t(openNode.spillSize);
+  assert(readOk);
+  (void)readOk;
+  openNode.storage = Storage::kCompressed;
+}
+
+void HighsNodeQueue::unspillNode(int64_t node) {
+  untrackStorage(node);
+  memoryUsage -= nodeMemory(node);
+
+  readSpilledNode(node);
+  link_domchgs(node);
+
+  memoryUsage += nodeMemory(node);
+  trackStorage(node);
+}
+
+void HighsNodeQueue::restorePlainNode(int64_t node) {
+  OpenNode& openNode = nodes[node];
+  if (openNode.storage == Storage::kPlain) return;
+  if (openNode.storage == Storage::kSpilled) readSpilledNode(node);
+
+  decodeNode(openNode.compressed, openNode.domchgstack, openNode.branchings);
+  std::vector<uint8_t>().swap(openNode.compressed);
+  openNode.storage = Storage::kPlain;
+}
+
+void HighsNodeQueue::enforceMemoryLimit() {
+  // the nodes with the largest lower bounds are the last to be searched, so
+  // they are compressed first and then spilled
+  while (getMemoryUsage() > memoryLimit && !plainNodes.empty())
+    compressNode(std::prev(plainNodes.end())->second);
+
+  while (getMemoryUsage() > memoryLimit && spillFile &&
+         !compressedNodes.empty())
+    spillNode(std::prev(compressedNodes.end())->second);
+
+  peakMemoryUsage = std::max(peakMemoryUsage, getMemoryUsage());
+}
+
+void HighsNodeQueue::restoreSpilledNodes() {
+  // spilled nodes are read back in the order of their lower bounds
+  while (!spilledNodes.empty()) {
+    int64_t node = spilledNodes.begin()->second;
+    int64_t size = nodes[node].spillSize +
+                   nodes[node].domchgStackSize * kNodeSetEntrySize;
+    if (getMemoryUsage() + size > kRestoreFraction * memoryLimit) break;
+    unspillNode(node);
+  }
+}
+
 void HighsNodeQueue::checkGlobalBounds(HighsInt col, double lb, double ub,
                                        double feastol,
                                        HighsCDouble& treeweight) {
@@ -386,13 +705,17 @@ double HighsNodeQueue::emplaceNode(std::vector<HighsDomainChange>&& domchgs,
   assert(nodes[pos].estimate == estimate);
   assert(nodes[pos].depth == depth);
 
-  return link(pos);
+  double treeweight = link(pos);
+  if (memoryLimit != kHighsInf) enforceMemoryLimit();
+  return treeweight;
 }
 
 HighsNodeQueue::OpenNode&& HighsNodeQueue::popBestNode() {
   int64_t bestNode = hybridEstimMin;
 
   unlink(bestNode);
+  restorePlainNode(bestNode);
+  restoreSpilledNodes();
 
   return std::move(nodes[bestNode]);
 }
@@ -401,6 +724,8 @@ HighsNodeQueue::OpenNode&& HighsNodeQueue::popBestBoundNode() {
   int64_t bestBoundNode = lowerMin;
 
   unlink(bestBoundNode);
+  restorePlainNode(bestBoundNode);
+  restoreSpilledNodes();
 
   return std::move(nodes[bestBoundNode]);
 }
@@ -416,9 +741,9 @@ double HighsNodeQueue::getBestLowerBound() const {
 HighsInt HighsNodeQueue::getBestBoundDomchgStackSize() const {
   HighsInt domchgStackSize = lowerMin == -1
                                  ? kHighsIInf
-                                 : HighsInt(nodes[lowerMin].domchgstack.size());
+                                 : nodes[lowerMin].domchgStackSize;
   if (suboptimalMin == -1) return domchgStackSize;
 
-  return std::min(HighsInt(nodes[suboptimalMin].domchgstack.size()),
+  return std::min(nodes[suboptimalMin].domchgStackSize,
                   domchgStackSize);
 }
\ No newline at end of file
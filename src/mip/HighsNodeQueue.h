@@ -16,6 +16,8 @@
 
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <cstdio>
 #include <memory>
 #include <queue>
 #include <set>
@@ -141,13 +143,22 @@ class HighsNodeQueue {
                            std::less<std::pair<double, int64_t>>,
                            NodesetAllocator<std::pair<double, int64_t>>>;
 
+  /// how the domain changes of an open node are stored: as plain vectors,
+  /// compressed into a byte buffer, or in the spill file
+  enum class Storage : uint8_t { kPlain, kCompressed, kSpilled };
+
   struct OpenNode {
     std::vector<HighsDomainChange> domchgstack;
     std::vector<HighsInt> branchings;
     std::vector<NodeSet::iterator> domchglinks;
+    std::vector<uint8_t> compressed;
     double lower_bound;
     double estimate;
     HighsInt depth;
+    HighsInt domchgStackSize;
+    Storage storage;
+    HighsInt spillSize;
+    int64_t spillOffset;
     highs::RbTreeLinks<int64_t> lowerLinks;
     highs::RbTreeLinks<int64_t> hybridEstimLinks;
 
@@ -155,9 +166,14 @@ class HighsNodeQueue {
         : domchgstack(),
           branchings(),
           domchglinks(),
+          compressed(),
           lower_bound(-kHighsInf),
           estimate(-kHighsInf),
           depth(0),
+          domchgStackSize(0),
+          storage(Storage::kPlain),
+          spillSize(0),
+          spillOffset(-1),
           lowerLinks(),
           hybridEstimLinks() {}
 
@@ -166,9 +182,14 @@ class HighsNodeQueue {
              double estimate, HighsInt depth)
         : domchgstack(domchgstack),
           branchings(branchings),
+          compressed(),
           lower_bound(lower_bound),
           estimate(estimate),
           depth(depth),
+          domchgStackSize(this->domchgstack.size()),
+          storage(Storage::kPlain),
+          spillSize(0),
+          spillOffset(-1),
           lowerLinks(),
           hybridEstimLinks() {}
 
@@ -201,6 +222,24 @@ class HighsNodeQueue {
   using NodeSetArray = std::unique_ptr<NodeSet, GlobalOperatorDelete>;
   NodeSetArray colLowerNodesPtr;
   NodeSetArray colUpperNodesPtr;
+
+  struct SpillFileClose {
+    void operator()(std::FILE* file) const { std::fclose(file); }
+  };
+  using SpillFile = std::unique_ptr<std::FILE, SpillFileClose>;
+  SpillFile spillFile;
+  int64_t spillFileEnd = 0;
+
+  /// open nodes by storage ordered by their lower bounds, only maintained
+  /// when the memory of the queue is limited
+  std::set<std::pair<double, int64_t>> plainNodes;
+  std::set<std::pair<double, int64_t>> compressedNodes;
+  std::set<std::pair<double, int64_t>> spilledNodes;
+  double memoryLimit = kHighsInf;
+  int64_t memoryUsage = 0;
+  int64_t peakMemoryUsage = 0;
+  int64_t numCompressed = 0;
+  int64_t numSpilled = 0;
   int64_t lowerRoot = -1;
   int64_t lowerMin = -1;
   int64_t hybridEstimRoot = -1;
@@ -231,6 +270,26 @@ class HighsNodeQueue {
 
   void unlink(int64_t node);
 
+  int64_t nodeMemory(int64_t node) const;
+
+  void trackStorage(int64_t node);
+
+  void untrackStorage(int64_t node);
+
+  void compressNode(int64_t node);
+
+  void spillNode(int64_t node);
+
+  void readSpilledNode(int64_t node);
+
+  void unspillNode(int64_t node);
+
+  void restorePlainNode(int64_t node);
+
+  void enforceMemoryLimit();
+
+  void restoreSpilledNodes();
+
  public:
   void setOptimalityLimit(double optimality_limit) {
     this->optimality_limit = optimality_limit;
@@ -240,6 +299,21 @@ class HighsNodeQueue {
 
   void setNumCol(HighsInt numcol);
 
+  /// limits the memory in bytes used for storing the open nodes, above which
+  /// the nodes with the largest lower bounds are compressed and then spilled
+  /// to a temporary file
+  void setMemoryLimit(double memoryLimit);
+
+  int64_t getMemoryUsage() const {
+    return memoryUsage + int64_t(nodes.capacity() * sizeof(OpenNode));
+  }
+
+  int64_t getPeakMemoryUsage() const { return peakMemoryUsage; }
+
+  int64_t numCompressedNodes() const { return numCompressed; }
+
+  int64_t numSpilledNodes() const { return numSpilled; }
+
   double emplaceNode(std::vector<HighsDomainChange>&& domchgs,
                      std::vector<HighsInt>&& branchings, double lower_bound,
                      double estimate, HighsInt depth);
@@ -291,6 +365,8 @@ class HighsNodeQueue {
   void clear() {
     HighsNodeQueue nodequeue;
     nodequeue.setNumCol(numCol);
+    nodequeue.setMemoryLimit(memoryLimit);
+    nodequeue.peakMemoryUsage = peakMemoryUsage;
     *this = std::move(nodequeue);
   }
 
@@ -91,6 +91,7 @@ bool HighsPrimalHeuristics::solveSubMip(
   submipoptions.mip_pscost_minreliable = 0;
   submipoptions.time_limit -=
       mipsolver.timer_.read(mipsolver.timer_.solve_clock);
+  submipoptions.work_limit -= mipsolver.mipdata_->workUnits();
   submipoptions.objective_bound = mipsolver.mipdata_->upper_limit;
 
   if (!mipsolver.submip) {
@@ -130,6 +131,8 @@ bool HighsPrimalHeuristics::solveSubMip(
     int64_t adjusted_lp_iterations =
         (size_t)(adjustmentfactor * submipsolver.mipdata_->total_lp_iterations);
     lp_iterations += adjusted_lp_iterations;
+    mipsolver.mipdata_->addWorkTicks(
+        submipsolver.mipdata_->work_ticks.load(std::memory_order_relaxed));
 
     if (mipsolver.submip)
       mipsolver.mipdata_->num_nodes += std::max(
@@ -127,6 +127,8 @@ class HighsPseudocost {
 
   HighsInt getMinReliable() const { return minreliable; }
 
+  HighsInt getNumCol() const { return pseudocostup.size(); }
+
   HighsInt getNumObservations(HighsInt col) const {
     return nsamplesup[col] + nsamplesdown[col];
   }
@@ -12,12 +12,15 @@
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #include "mip/HighsSearch.h"
 
+#include <algorithm>
+#include <memory>
 #include <numeric>
 
 #include "lp_data/HConst.h"
 #include "mip/HighsCutGeneration.h"
 #include "mip/HighsDomainChange.h"
 #include "mip/HighsMipSolverData.h"
+#include "parallel/HighsParallel.h"
 
 HighsSearch::HighsSearch(HighsMipSolver& mipsolver,
                          const HighsPseudocost& pseudocost)
@@ -245,6 +248,120 @@ void HighsSearch::addInfeasibleConflict() {
   }
 }
 
+void HighsSearch::strongBranchConcurrently(
+    std::vector<double>& upscore, std::vector<double>& downscore,
+    std::vector<uint8_t>& upscorereliable,
+    std::vector<uint8_t>& downscorereliable, std::vector<double>& upbound,
+    std::vector<double>& downbound) {
+  if (inheuristic || mipsolver.submip ||
+      mipsolver.options_mip_->mip_parallel_tree_search !=
+          kMipParallelTreeSearchOff)
+    return;
+
+  // evaluate at least two candidates per batch, so that the batch is
+  // well defined when the scheduler has a single worker
+  const HighsInt batchSize =
+      std::max(HighsInt{2}, (HighsInt)highs::parallel::num_threads());
+
+  const auto& fracints = lp->getFractionalIntegers();
+  HighsInt numfrac = fracints.size();
+
+  // candidates with an unreliable branch, best pseudocost score first and
+  // ties broken by position so that the selection is deterministic
+  std::vector<std::pair<double, HighsInt>> candidates;
+  for (HighsInt k = 0; k != numfrac; ++k) {
+    if (upscorereliable[k] && downscorereliable[k]) continue;
+    candidates.emplace_back(
+        pseudocost.getScore(fracints[k].first, fracints[k].second), k);
+  }
+
+  std::sort(candidates.begin(), candidates.end(),
+            [](const std::pair<double, HighsInt>& a,
+               const std::pair<double, HighsInt>& b) {
+              return a.first > b.first ||
+                     (a.first == b.first && a.second < b.second);
+            });
+  if ((HighsInt)candidates.size() > batchSize) candidates.resize(batchSize);
+
+  struct BranchEvaluation {
+    HighsInt k;
+    bool up;
+    std::unique_ptr<HighsLpRelaxation> lp;
+  };
+
+  std::vector<BranchEvaluation> evals;
+  for (const auto& candidate : candidates) {
+    HighsInt k = candidate.second;
+    if (!downscorereliable[k]) evals.push_back({k, false, nullptr});
+    if (!upscorereliable[k]) evals.push_back({k, true, nullptr});
+  }
+  if (evals.size() < 2) return;
+
+  // the copies start from the basis of the node LP, so each branch is a
+  // warm started dual simplex solve after a single bound change
+  const HighsLp& nodelp = lp->getLpSolver().getLp();
+  for (BranchEvaluation& eval : evals) {
+    HighsInt col = fracints[eval.k].first;
+    double fracval = fracints[eval.k].second;
+    eval.lp.reset(new HighsLpRelaxation(*lp));
+    eval.lp->setNotifyCutPool(false);
+    eval.lp->setObjectiveLimit(mipsolver.mipdata_->upper_limit);
+    if (eval.up)
+      eval.lp->getLpSolver().changeColBounds(col, std::ceil(fracval),
+                                             nodelp.col_upper_[col]);
+    else
+      eval.lp->getLpSolver().changeColBounds(col, nodelp.col_lower_[col],
+                                             std::floor(fracval));
+  }
+
+  highs::parallel::for_each(
+      0, (HighsInt)evals.size(), [&](HighsInt start, HighsInt end) {
+        for (HighsInt i = start; i < end; ++i) evals[i].lp->solveAhead();
+      });
+
+  // merge in the order of the evaluations so that the pseudocosts and
+  // incumbents do not depend on the order in which the solves finished
+  for (BranchEvaluation& eval : evals) {
+    HighsLpRelaxation::Status status = eval.lp->run(false);
+    int64_t numiters = eval.lp->getNumLpIterations();
+    lpiterations += numiters;
+    sblpiterations += numiters;
+
+    if (!HighsLpRelaxation::scaledOptimal(status) ||
+        !HighsLpRelaxation::unscaledDualFeasible(status))
+      continue;
+
+    HighsInt col = fracints[eval.k].first;
+    double fracval = fracints[eval.k].second;
+    bool integerfeasible;
+    const std::vector<double>& sol =
+        eval.lp->getLpSolver().getSolution().col_value;
+    double solobj = checkSol(sol, integerfeasible);
+
+    if (HighsLpRelaxation::unscaledPrimalFeasible(status) && integerfeasible)
+      mipsolver.mipdata_->addIncumbent(sol, solobj, 'B');
+
+    if (solobj > mipsolver.mipdata_->optimality_limit) continue;
+
+    double objdelta = std::max(solobj - lp->getObjective(), 0.0);
+    if (objdelta <= mipsolver.mipdata_->epsilon) objdelta = 0.0;
+
+    if (eval.up) {
+      upscore[eval.k] = objdelta;
+      upscorereliable[eval.k] = true;
+      upbound[eval.k] = solobj;
+      markBranchingVarUpReliableAtNode(col);
+      pseudocost.addObservation(col, std::ceil(fracval) - fracval, objdelta);
+    } else {
+      downscore[eval.k] = objdelta;
+      downscorereliable[eval.k] = true;
+      downbound[eval.k] = solobj;
+      markBranchingVarDownReliableAtNode(col);
+      pseudocost.addObservation(col, std::floor(fracval) - fracval, objdelta);
+    }
+  }
+}
+
 HighsInt HighsSearch::selectBranchingCandidate(int64_t maxSbIters,
                                                double& downNodeLb,
                                                double& upNodeLb) {
@@ -297,6 +414,11 @@ HighsInt HighsSearch::selectBranchingCandidate(int64_t maxSbIters,
     }
   }
 
+  if (mipsolver.options_mip_->mip_parallel_strong_branching &&
+      getStrongBranchingLpIterations() < maxSbIters)
+    strongBranchConcurrently(upscore, downscore, upscorereliable,
+                             downscorereliable, upbound, downbound);
+
   std::vector<HighsInt> evalqueue;
   evalqueue.resize(numfrac);
   std::iota(evalqueue.begin(), evalqueue.end(), 0);
@@ -932,17 +1054,10 @@ void HighsSearch::installNode(HighsNodeQueue::OpenNode&& node) {
   depthoffset = node.depth - 1;
 }
 
-HighsSearch::NodeResult HighsSearch::evaluateNode() {
-  assert(!nodestack.empty());
+void HighsSearch::propagateNode() {
   NodeData& currnode = nodestack.back();
   const NodeData* parent = getParentNodeData();
 
-  const auto& domchgstack = localdom.getDomainChangeStack();
-
-  if (!inheuristic &&
-      currnode.lower_bound > mipsolver.mipdata_->optimality_limit)
-    return NodeResult::kSubOptimal;
-
   localdom.propagate();
 
   if (!inheuristic && !localdom.infeasible()) {
@@ -959,6 +1074,35 @@ HighsSearch::NodeResult HighsSearch::evaluateNode() {
     else
       mipsolver.mipdata_->symmetries.propagateOrbitopes(localdom);
   }
+}
+
+bool HighsSearch::prepareNodeLp() {
+  assert(!nodestack.empty());
+  if (!inheuristic &&
+      nodestack.back().lower_bound > mipsolver.mipdata_->optimality_limit)
+    return false;
+
+  propagateNode();
+  if (localdom.infeasible()) return false;
+
+  lp->flushDomain(localdom);
+  lp->setObjectiveLimit(mipsolver.mipdata_->upper_limit);
+  return true;
+}
+
+HighsSearch::NodeResult HighsSearch::evaluateNode() {
+  assert(!nodestack.empty());
+  NodeData& currnode = nodestack.back();
+  const NodeData* parent = getParentNodeData();
+
+  const auto& domchgstack = localdom.getDomainChangeStack();
+
+  if (!inheuristic &&
+      currnode.lower_bound > mipsolver.mipdata_->optimality_limit)
+    return NodeResult::kSubOptimal;
+
+  propagateNode();
+
   if (parent != nullptr) {
     int64_t inferences = domchgstack.size() - (currnode.domgchgStackPos + 1);
 
@@ -1864,6 +2008,16 @@ HighsSearch::NodeResult HighsSearch::dive() {
   } while (true);
 }
 
+HighsSearch::NodeResult HighsSearch::diveStep(bool newDive) {
+  if (newDive) reliableatnode.clear();
+
+  ++nnodes;
+  NodeResult result = evaluateNode();
+  if (result != NodeResult::kOpen) return result;
+
+  return branch();
+}
+
 void HighsSearch::solveDepthFirst(int64_t maxbacktracks) {
   do {
     if (maxbacktracks == 0) break;
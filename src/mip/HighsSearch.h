@@ -142,6 +142,19 @@ class HighsSearch {
 
   bool orbitsValidInChildNode(const HighsDomainChange& branchChg) const;
 
+  /// evaluates the unreliable branches of the candidates with the best
+  /// pseudocost scores concurrently on copies of the LP relaxation and merges
+  /// the results in candidate order. Branches that are infeasible or exceed
+  /// the cutoff are left to the serial strong branching loop
+  void strongBranchConcurrently(std::vector<double>& upscore,
+                                std::vector<double>& downscore,
+                                std::vector<uint8_t>& upscorereliable,
+                                std::vector<uint8_t>& downscorereliable,
+                                std::vector<double>& upbound,
+                                std::vector<double>& downbound);
+
+  void propagateNode();
+
  public:
   HighsSearch(HighsMipSolver& mipsolver, const HighsPseudocost& pseudocost);
 
@@ -212,6 +225,12 @@ class HighsSearch {
 
   const NodeData* getParentNodeData() const;
 
+  /// propagates the current node and passes its domain and the cutoff bound
+  /// to the LP relaxation. Returns true if the node requires an LP solve, which
+  /// can then be done by HighsLpRelaxation::solveAhead() before the node is
+  /// evaluated
+  bool prepareNodeLp();
+
   NodeResult evaluateNode();
 
   NodeResult branch();
@@ -232,6 +251,11 @@ class HighsSearch {
 
   NodeResult dive();
 
+  /// evaluates the current node and branches if it stays open, i.e. performs
+  /// a single step of dive(). The first step of each dive must pass true for
+  /// newDive
+  NodeResult diveStep(bool newDive);
+
   HighsDomain& getLocalDomain() { return localdom; }
 
   const HighsDomain& getLocalDomain() const { return localdom; }
@@ -26,6 +26,7 @@
 #include "mip/HighsPathSeparator.h"
 #include "mip/HighsTableauSeparator.h"
 #include "mip/HighsTransformedLp.h"
+#include "parallel/HighsParallel.h"
 
 HighsSeparation::HighsSeparation(const HighsMipSolver& mipsolver) {
   implBoundClock = mipsolver.timer_.clock_def("Implbound sepa", "Ibd");
@@ -108,14 +109,25 @@ HighsInt HighsSeparation::separationRound(HighsDomain& propdomain,
     status = HighsLpRelaxation::Status::kInfeasible;
     return 0;
   }
-  HighsLpAggregator lpAggregator(*lp);
 
-  for (const std::unique_ptr<HighsSeparator>& separator : separators) {
-    separator->run(*lp, lpAggregator, transLp, mipdata.cutpool);
+  // separation of the global domain, i.e. in the root cut loop, uses all
+  // threads of the scheduler
+  if (&propdomain == &mipdata.domain && highs::parallel::num_threads() > 1) {
+    separateConcurrently(transLp);
     if (mipdata.domain.infeasible()) {
       status = HighsLpRelaxation::Status::kInfeasible;
       return 0;
     }
+  } else {
+    HighsLpAggregator lpAggregator(*lp);
+
+    for (const std::unique_ptr<HighsSeparator>& separator : separators) {
+      separator->run(*lp, lpAggregator, transLp, mipdata.cutpool);
+      if (mipdata.domain.infeasible()) {
+        status = HighsLpRelaxation::Status::kInfeasible;
+        return 0;
+      }
+    }
   }
 
   numboundchgs = propagateAndResolve();
@@ -142,6 +154,48 @@ HighsInt HighsSeparation::separationRound(HighsDomain& propdomain,
   return ncuts;
 }
 
+void HighsSeparation::separateConcurrently(const HighsTransformedLp& transLp) {
+  const HighsMipSolver& mipsolver = lp->getMipSolver();
+  HighsMipSolverData& mipdata = *mipsolver.mipdata_;
+  HighsInt numSepa = separators.size();
+
+  // the separators only read the LP relaxation and the global domain, and
+  // the cut buffers have no propagation domains attached, so the only
+  // shared state that is written to is the global cutpool during the merge
+  std::vector<HighsCutPool> cutbuffers;
+  cutbuffers.reserve(numSepa);
+  for (HighsInt i = 0; i != numSepa; ++i)
+    cutbuffers.emplace_back(mipsolver.numCol(),
+                            mipsolver.options_mip_->mip_pool_age_limit,
+                            mipsolver.options_mip_->mip_pool_soft_limit);
+
+  highs::parallel::for_each(0, numSepa, [&](HighsInt start, HighsInt end) {
+    for (HighsInt i = start; i < end; ++i) {
+      HighsLpAggregator lpAggregator(*lp);
+      HighsTransformedLp sepaTransLp(transLp);
+      separators[i]->run(*lp, lpAggregator, sepaTransLp, cutbuffers[i]);
+    }
+  });
+
+  std::vector<HighsInt> cutinds;
+  std::vector<double> cutvals;
+  for (const HighsCutPool& cutbuffer : cutbuffers) {
+    HighsInt numCuts = cutbuffer.getNumCuts();
+    for (HighsInt cut = 0; cut != numCuts; ++cut) {
+      HighsInt cutlen;
+      const HighsInt* inds;
+      const double* vals;
+      cutbuffer.getCut(cut, cutlen, inds, vals);
+      cutinds.assign(inds, inds + cutlen);
+      cutvals.assign(vals, vals + cutlen);
+      mipdata.cutpool.addCut(mipsolver, cutinds.data(), cutvals.data(), cutlen,
+                             cutbuffer.getRhs()[cut],
+                             cutbuffer.cutIsIntegral(cut));
+      if (mipdata.domain.infeasible()) return;
+    }
+  }
+}
+
 void HighsSeparation::separate(HighsDomain& propdomain) {
   HighsLpRelaxation::Status status = lp->getStatus();
   const HighsMipSolver& mipsolver = lp->getMipSolver();
@@ -36,6 +36,12 @@ class HighsSeparation {
   HighsSeparation(const HighsMipSolver& mipsolver);
 
  private:
+  /// runs the separators concurrently, each with its own aggregator, copy of
+  /// the transformed LP and cut buffer. The buffered cuts are added to the
+  /// global cutpool afterwards in the order of the separators, so that
+  /// duplicates are removed and the result does not depend on scheduling
+  void separateConcurrently(const HighsTransformedLp& transLp);
+
   HighsInt implBoundClock;
   HighsInt cliqueClock;
   std::vector<std::unique_ptr<HighsSeparator>> separators;
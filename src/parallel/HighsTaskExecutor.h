@@ -158,6 +158,9 @@ class HighsTaskExecutor {
       }
 
       executorHandle.ptr.reset();
+      // the worker deque of this thread is owned by the executor, so
+      // don't leave it dangling
+      threadLocalWorkerDeque() = nullptr;
     }
   }
 
@@ -15,6 +15,7 @@
 #include <algorithm>
 #include <atomic>
 #include <cmath>
+#include <functional>
 #include <limits>
 
 #include "Highs.h"
@@ -27,6 +28,7 @@
 #include "mip/HighsImplications.h"
 #include "mip/HighsMipSolverData.h"
 #include "mip/HighsObjectiveFunction.h"
+#include "parallel/HighsParallel.h"
 #include "pdqsort/pdqsort.h"
 #include "presolve/HighsPostsolveStack.h"
 #include "test/DevKkt.h"
@@ -75,6 +77,7 @@ void HPresolve::setInput(HighsLp& model_, const HighsOptions& options_,
   model = &model_;
   options = &options_;
   this->timer = timer;
+  parallel = options->parallel == kHighsOnString;
 
   colLowerSource.resize(model->num_col_, -1);
   colUpperSource.resize(model->num_col_, -1);
@@ -944,19 +947,34 @@ HPresolve::Result HPresolve::dominatedColumns(
     return true;
   };
 
-  HighsInt numNz = Avalue.size();
-  for (HighsInt i = 0; i < numNz; ++i) {
-    if (Avalue[i] == 0) continue;
-
-    HighsInt row = Arow[i];
-    HighsInt col = Acol[i];
+  auto addNonzeroSignature = [&](HighsInt row, HighsInt col, double val) {
     bool rowLowerFinite = model->row_lower_[row] != -kHighsInf;
     bool rowUpperFinite = model->row_upper_[row] != kHighsInf;
 
-    if (Avalue[i] > 0)
+    if (val > 0)
       addSignature(row, col, rowLowerFinite, rowUpperFinite);
     else
       addSignature(row, col, rowUpperFinite, rowLowerFinite);
+  };
+
+  if (!parallel) {
+    HighsInt numNz = Avalue.size();
+    for (HighsInt i = 0; i < numNz; ++i) {
+      if (Avalue[i] == 0) continue;
+      addNonzeroSignature(Arow[i], Acol[i], Avalue[i]);
+    }
+  } else {
+    // each column only sets bits in its own signature
+    highs::parallel::for_each(
+        0, model->num_col_,
+        [&](HighsInt start, HighsInt end) {
+          for (HighsInt col = start; col < end; ++col) {
+            if (colDeleted[col]) continue;
+            for (const HighsSliceNonzero& nonz : getColumnVector(col))
+              addNonzeroSignature(nonz.index(), col, nonz.value());
+          }
+        },
+        kParallelGrainSize);
   }
 
   HighsInt numFixedCols = 0;
@@ -1301,15 +1319,46 @@ HPresolve::Result HPresolve::runProbing(HighsPostsolveStack& postsolve_stack) {
   if (!mipsolver->mipdata_->cliquetable.isFull()) {
     binaries.reserve(model->num_col_);
     HighsRandom random(options->random_seed);
-    for (HighsInt i = 0; i != model->num_col_; ++i) {
-      if (domain.isBinary(i)) {
-        HighsInt implicsUp = cliquetable.getNumImplications(i, 1);
-        HighsInt implicsDown = cliquetable.getNumImplications(i, 0);
+    if (!parallel) {
+      for (HighsInt i = 0; i != model->num_col_; ++i) {
+        if (domain.isBinary(i)) {
+          HighsInt implicsUp = cliquetable.getNumImplications(i, 1);
+          HighsInt implicsDown = cliquetable.getNumImplications(i, 0);
+          binaries.emplace_back(
+              -std::min(int64_t{5000}, int64_t(implicsUp) * implicsDown) /
+                  (1.0 + numProbes[i]),
+              -std::min(HighsInt{100}, implicsUp + implicsDown),
+              random.integer(), i);
+        }
+      }
+    } else {
+      // count the implications concurrently, the clique table is only read,
+      // and draw the random tie breakers afterwards in the serial order
+      std::vector<HighsInt> binaryCols;
+      for (HighsInt i = 0; i != model->num_col_; ++i)
+        if (domain.isBinary(i)) binaryCols.push_back(i);
+      HighsInt numBinary = binaryCols.size();
+      std::vector<std::pair<HighsInt, HighsInt>> implics(numBinary);
+      highs::parallel::for_each(
+          0, numBinary,
+          [&](HighsInt start, HighsInt end) {
+            for (HighsInt k = start; k < end; ++k) {
+              implics[k].first =
+                  cliquetable.getNumImplications(binaryCols[k], 1);
+              implics[k].second =
+                  cliquetable.getNumImplications(binaryCols[k], 0);
+            }
+          },
+          kParallelGrainSize);
+      for (HighsInt k = 0; k != numBinary; ++k) {
+        HighsInt i = binaryCols[k];
+        HighsInt implicsUp = implics[k].first;
+        HighsInt implicsDown = implics[k].second;
         binaries.emplace_back(
             -std::min(int64_t{5000}, int64_t(implicsUp) * implicsDown) /
                 (1.0 + numProbes[i]),
-            -std::min(HighsInt{100}, implicsUp + implicsDown), random.integer(),
-            i);
+            -std::min(HighsInt{100}, implicsUp + implicsDown),
+            random.integer(), i);
       }
     }
   }
@@ -5039,18 +5088,58 @@ HPresolve::Result HPresolve::detectParallelRowsAndCols(
 
   // Step 2: Compute hash values for rows and columns excluding singleton
   // columns
-  for (HighsInt i = 0; i != nnz; ++i) {
-    if (Avalue[i] == 0.0) continue;
-    assert(!rowDeleted[Arow[i]] && !colDeleted[Acol[i]]);
-    if (colsize[Acol[i]] == 1) {
-      colHashes[Acol[i]] = Arow[i];
-    } else {
-      HighsHashHelpers::sparse_combine(rowHashes[Arow[i]], Acol[i],
-                                       HighsHashHelpers::double_hash_code(
-                                           Avalue[i] / rowMax[Arow[i]].first));
-      HighsHashHelpers::sparse_combine(colHashes[Acol[i]], Arow[i],
-                                       HighsHashHelpers::double_hash_code(
-                                           Avalue[i] / colMax[Acol[i]].first));
+  if (!parallel) {
+    for (HighsInt i = 0; i != nnz; ++i) {
+      if (Avalue[i] == 0.0) continue;
+      assert(!rowDeleted[Arow[i]] && !colDeleted[Acol[i]]);
+      if (colsize[Acol[i]] == 1) {
+        colHashes[Acol[i]] = Arow[i];
+      } else {
+        HighsHashHelpers::sparse_combine(
+            rowHashes[Arow[i]], Acol[i],
+            HighsHashHelpers::double_hash_code(Avalue[i] /
+                                               rowMax[Arow[i]].first));
+        HighsHashHelpers::sparse_combine(
+            colHashes[Acol[i]], Arow[i],
+            HighsHashHelpers::double_hash_code(Avalue[i] /
+                                               colMax[Acol[i]].first));
+      }
+    }
+  } else {
+    // the sparse hash does not depend on the order in which the nonzeros are
+    // combined, so the row and column hashes can be computed independently
+    // from the row and column vectors and are the same as in the serial loop
+    highs::parallel::for_each(
+        0, model->num_col_,
+        [&](HighsInt start, HighsInt end) {
+          for (HighsInt col = start; col < end; ++col) {
+            if (colDeleted[col] || colsize[col] <= 1) continue;
+            for (const HighsSliceNonzero& nonz : getColumnVector(col))
+              HighsHashHelpers::sparse_combine(
+                  colHashes[col], nonz.index(),
+                  HighsHashHelpers::double_hash_code(nonz.value() /
+                                                     colMax[col].first));
+          }
+        },
+        kParallelGrainSize);
+    highs::parallel::for_each(
+        0, model->num_row_,
+        [&](HighsInt start, HighsInt end) {
+          for (HighsInt row = start; row < end; ++row) {
+            if (rowDeleted[row]) continue;
+            for (const HighsSliceNonzero& nonz : getRowVector(row)) {
+              if (colsize[nonz.index()] == 1) continue;
+              HighsHashHelpers::sparse_combine(
+                  rowHashes[row], nonz.index(),
+                  HighsHashHelpers::double_hash_code(nonz.value() /
+                                                     rowMax[row].first));
+            }
+          }
+        },
+        kParallelGrainSize);
+    for (HighsInt col = 0; col != model->num_col_; ++col) {
+      if (colDeleted[col] || colsize[col] != 1) continue;
+      colHashes[col] = Arow[colhead[col]];
     }
   }
 
@@ -6003,6 +6092,11 @@ void HPresolve::debug(const HighsLp& lp, const HighsOptions& options) {
 
 HPresolve::Result HPresolve::sparsify(HighsPostsolveStack& postsolve_stack) {
   std::vector<HighsPostsolveStack::Nonzero> sparsifyRows;
+  // candidate rows with the column value, replaced by the candidate's scale
+  std::vector<HighsPostsolveStack::Nonzero> candidates;
+  // the work per candidate row is proportional to the equation length, hence
+  // use a smaller grain size than for the passes over all rows/columns
+  const HighsInt kSparsifyGrainSize = 16;
   HPRESOLVE_CHECKED_CALL(removeRowSingletons(postsolve_stack));
   HPRESOLVE_CHECKED_CALL(removeDoubletonEquations(postsolve_stack));
   std::vector<HighsInt> tmpEquations;
@@ -6036,14 +6130,10 @@ HPresolve::Result HPresolve::sparsify(HighsPostsolveStack& postsolve_stack) {
 
     assert(sparsestCol != -1 && secondSparsestColumn != -1);
 
-    std::map<double, HighsInt> possibleScales;
-    sparsifyRows.clear();
-
-    for (const HighsSliceNonzero& colNz : getColumnVector(sparsestCol)) {
-      HighsInt candRow = colNz.index();
-      if (candRow == eqrow) continue;
-
-      possibleScales.clear();
+    // returns the scale with which the equation is added to the candidate row
+    // containing the sparsest column, or zero if no nonzero is cancelled
+    auto sparsestColScale = [&](HighsInt candRow, double candColVal) {
+      std::map<double, HighsInt> possibleScales;
 
       HighsInt misses = 0;
       // allow no fillin if a completely continuous row is used to cancel a row
@@ -6055,7 +6145,7 @@ HPresolve::Result HPresolve::sparsify(HighsPostsolveStack& postsolve_stack) {
       for (const HighsSliceNonzero& nonzero : getStoredRow()) {
         double candRowVal;
         if (nonzero.index() == sparsestCol) {
-          candRowVal = colNz.value();
+          candRowVal = candColVal;
         } else {
           HighsInt nzPos = findNonzero(candRow, nonzero.index());
           if (nzPos == -1) {
@@ -6102,7 +6192,7 @@ HPresolve::Result HPresolve::sparsify(HighsPostsolveStack& postsolve_stack) {
           possibleScales.emplace(scale, 1);
       }
 
-      if (misses > maxMisses || possibleScales.empty()) continue;
+      if (misses > maxMisses || possibleScales.empty()) return 0.0;
 
       HighsInt numCancel = 0;
       double scale = 0.0;
@@ -6121,96 +6211,126 @@ HPresolve::Result HPresolve::sparsify(HighsPostsolveStack& postsolve_stack) {
 
       // cancels at least one nonzero if the scale cancels more than there is
       // fillin
-      if (numCancel > misses) sparsifyRows.emplace_back(candRow, scale);
-    }
+      return numCancel > misses ? scale : 0.0;
+    };
 
-    if (model->integrality_[sparsestCol] != HighsVarType::kInteger ||
-        (model->col_upper_[sparsestCol] - model->col_lower_[sparsestCol]) <
-            1.5) {
-      // now check for rows which do not contain the sparsest column but all
-      // other columns by scanning the second sparsest column
-      for (const HighsSliceNonzero& colNz :
-           getColumnVector(secondSparsestColumn)) {
-        HighsInt candRow = colNz.index();
-        if (candRow == eqrow) continue;
+    // same for a candidate row containing the second sparsest column
+    auto secondSparsestColScale = [&](HighsInt candRow, double candColVal) {
+      if (rowsizeInteger[eqrow] == 0 && rowsizeInteger[candRow] != 0)
+        return 0.0;
 
-        if (rowsizeInteger[eqrow] == 0 && rowsizeInteger[candRow] != 0)
-          continue;
+      HighsInt sparsestColPos = findNonzero(candRow, sparsestCol);
 
-        HighsInt sparsestColPos = findNonzero(candRow, sparsestCol);
+      // if the row has a nonzero for the sparsest column we have already
+      // checked it
+      if (sparsestColPos != -1) return 0.0;
 
-        // if the row has a nonzero for the sparsest column we have already
-        // checked it
-        if (sparsestColPos != -1) continue;
+      std::map<double, HighsInt> possibleScales;
+      for (const HighsSliceNonzero& nonzero : getStoredRow()) {
+        double candRowVal;
+        if (nonzero.index() == secondSparsestColumn) {
+          candRowVal = candColVal;
+        } else {
+          HighsInt nzPos = findNonzero(candRow, nonzero.index());
+          // we already have a miss for the sparsest column, so with another
+          // one we want to skip the row
+          if (nzPos == -1) return 0.0;
 
-        possibleScales.clear();
-        bool skip = false;
-        for (const HighsSliceNonzero& nonzero : getStoredRow()) {
-          double candRowVal;
-          if (nonzero.index() == secondSparsestColumn) {
-            candRowVal = colNz.value();
-          } else {
-            HighsInt nzPos = findNonzero(candRow, nonzero.index());
-            if (nzPos == -1) {
-              // we already have a miss for the sparsest column, so with another
-              // one we want to skip the row
-              skip = true;
-              break;
-            }
+          candRowVal = Avalue[nzPos];
+        }
+
+        double scale = -candRowVal / nonzero.value();
+        if (std::abs(scale) > 1e3) continue;
 
-            candRowVal = Avalue[nzPos];
+        double scaleTolerance = minNonzeroVal / std::abs(nonzero.value());
+        auto it = possibleScales.lower_bound(scale - scaleTolerance);
+        if (it != possibleScales.end() &&
+            std::abs(it->first - scale) <= scaleTolerance) {
+          // there already is a scale that is very close and could produces
+          // a matrix value for this nonzero that is below the allowed
+          // threshold. Therefore we check if the matrix value is small enough
+          // for this nonzero to be deleted, in which case the number of
+          // deleted nonzeros for the other scale is increased. If it is not
+          // small enough we do not use this scale or the other one because
+          // such small matrix values may lead to numerical troubles.
+
+          // scale is already marked to be numerically bad
+          if (it->second == -1) continue;
+
+          if (std::abs(it->first * nonzero.value() + candRowVal) <=
+              options->small_matrix_value) {
+            it->second += 1;
+          } else {
+            // mark scale to be numerically bad
+            it->second = -1;
+            continue;
           }
+        } else
+          possibleScales.emplace(scale, 1);
+      }
 
-          double scale = -candRowVal / nonzero.value();
-          if (std::abs(scale) > 1e3) continue;
-
-          double scaleTolerance = minNonzeroVal / std::abs(nonzero.value());
-          auto it = possibleScales.lower_bound(scale - scaleTolerance);
-          if (it != possibleScales.end() &&
-              std::abs(it->first - scale) <= scaleTolerance) {
-            // there already is a scale that is very close and could produces
-            // a matrix value for this nonzero that is below the allowed
-            // threshold. Therefore we check if the matrix value is small enough
-            // for this nonzero to be deleted, in which case the number of
-            // deleted nonzeros for the other scale is increased. If it is not
-            // small enough we do not use this scale or the other one because
-            // such small matrix values may lead to numerical troubles.
-
-            // scale is already marked to be numerically bad
-            if (it->second == -1) continue;
-
-            if (std::abs(it->first * nonzero.value() + candRowVal) <=
-                options->small_matrix_value) {
-              it->second += 1;
-            } else {
-              // mark scale to be numerically bad
-              it->second = -1;
-              continue;
-            }
-          } else
-            possibleScales.emplace(scale, 1);
+      if (possibleScales.empty()) return 0.0;
+
+      HighsInt numCancel = 0;
+      double scale = 0.0;
+
+      for (const auto& s : possibleScales) {
+        if (s.second <= 1) continue;
+        if (s.second > numCancel ||
+            (s.second == numCancel && std::abs(s.first) < std::abs(scale))) {
+          scale = s.first;
+          numCancel = s.second;
         }
+      }
 
-        if (skip || possibleScales.empty()) continue;
+      assert(scale != 0.0 || numCancel == 0);
 
-        HighsInt numCancel = 0;
-        double scale = 0.0;
+      // cancels at least one nonzero if the scale cancels more than there is
+      // fillin
+      return numCancel > 1 ? scale : 0.0;
+    };
 
-        for (const auto& s : possibleScales) {
-          if (s.second <= 1) continue;
-          if (s.second > numCancel ||
-              (s.second == numCancel && std::abs(s.first) < std::abs(scale))) {
-            scale = s.first;
-            numCancel = s.second;
+    // evaluates the candidate rows of the given column in order. In parallel
+    // mode the rows are evaluated concurrently, which is safe since the lookup
+    // of a nonzero only reorganizes the splay tree of the candidate row
+    // itself, and the result is the same as in the serial evaluation.
+    auto addSparsifyRows =
+        [&](HighsInt col,
+            const std::function<double(HighsInt, double)>& candidateScale) {
+          if (!parallel) {
+            for (const HighsSliceNonzero& colNz : getColumnVector(col)) {
+              if (colNz.index() == eqrow) continue;
+              double scale = candidateScale(colNz.index(), colNz.value());
+              if (scale != 0.0) sparsifyRows.emplace_back(colNz.index(), scale);
+            }
+            return;
           }
-        }
+          candidates.clear();
+          for (const HighsSliceNonzero& colNz : getColumnVector(col))
+            if (colNz.index() != eqrow)
+              candidates.emplace_back(colNz.index(), colNz.value());
+          HighsInt numCandidates = candidates.size();
+          highs::parallel::for_each(
+              0, numCandidates,
+              [&](HighsInt start, HighsInt end) {
+                for (HighsInt k = start; k < end; ++k)
+                  candidates[k].value =
+                      candidateScale(candidates[k].index, candidates[k].value);
+              },
+              kSparsifyGrainSize);
+          for (const auto& candidate : candidates)
+            if (candidate.value != 0.0) sparsifyRows.push_back(candidate);
+        };
 
-        assert(scale != 0.0 || numCancel == 0);
+    sparsifyRows.clear();
+    addSparsifyRows(sparsestCol, sparsestColScale);
 
-        // cancels at least one nonzero if the scale cancels more than there is
-        // fillin
-        if (numCancel > 1) sparsifyRows.emplace_back(candRow, scale);
-      }
+    if (model->integrality_[sparsestCol] != HighsVarType::kInteger ||
+        (model->col_upper_[sparsestCol] - model->col_lower_[sparsestCol]) <
+            1.5) {
+      // now check for rows which do not contain the sparsest column but all
+      // other columns by scanning the second sparsest column
+      addSparsifyRows(secondSparsestColumn, secondSparsestColScale);
     }
 
     if (sparsifyRows.empty()) continue;
@@ -45,6 +45,11 @@ class HPresolve {
   HighsMipSolver* mipsolver = nullptr;
   double primal_feastol;
 
+  // whether the expensive passes compute their candidates concurrently, and
+  // the minimum number of rows/columns handled by one task in that case
+  bool parallel;
+  static constexpr HighsInt kParallelGrainSize = 256;
+
   // triplet storage
   std::vector<double> Avalue;
   std::vector<HighsInt> Arow;
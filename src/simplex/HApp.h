@@ -45,6 +45,7 @@ HighsStatus returnFromSolveLpSimplex(HighsLpSolverObject& solver_object,
   // Copy the simplex iteration count to highs_info_ from ekk_instance
   solver_object.highs_info_.simplex_iteration_count =
       ekk_instance.iteration_count_;
+  solver_object.highs_info_.work_units = ekk_instance.work_units_;
   // Ensure that the incumbent LP is neither moved, nor scaled
   assert(!incumbent_lp.is_moved_);
   assert(!incumbent_lp.is_scaled_);
@@ -105,6 +106,7 @@ HighsStatus solveLpSimplex(HighsLpSolverObject& solver_object) {
   // Copy the simplex iteration count from highs_info_ to ekk_instance, just for
   // convenience
   ekk_instance.iteration_count_ = highs_info.simplex_iteration_count;
+  ekk_instance.work_units_ = highs_info.work_units;
 
   // Reset the model status and HighsInfo values in case of premature
   // return
@@ -231,6 +233,7 @@ HighsStatus solveLpSimplex(HighsLpSolverObject& solver_object) {
       scaled_model_status = ekk_instance.model_status_;
       highs_info.objective_function_value = ekk_info.primal_objective_value;
       highs_info.simplex_iteration_count = ekk_instance.iteration_count_;
+      highs_info.work_units = ekk_instance.work_units_;
       solution = ekk_instance.getSolution();
       basis = ekk_instance.getHighsBasis(ekk_lp);
       assert(basis.valid);
@@ -379,6 +382,7 @@ HighsStatus solveLpSimplex(HighsLpSolverObject& solver_object) {
     scaled_model_status = ekk_instance.model_status_;
     highs_info.objective_function_value = ekk_info.primal_objective_value;
     highs_info.simplex_iteration_count = ekk_instance.iteration_count_;
+    highs_info.work_units = ekk_instance.work_units_;
     solution = ekk_instance.getSolution();
     basis = ekk_instance.getHighsBasis(ekk_lp);
     assert(basis.valid);
@@ -25,6 +25,7 @@
 #include "simplex/HSimplexDebug.h"
 #include "simplex/HSimplexReport.h"
 #include "simplex/SimplexTimer.h"
+#include "util/HighsPrefetch.h"
 
 using std::fabs;
 using std::max;
@@ -88,6 +89,8 @@ void HEkk::clearNlaInvertStatus() {
 void HEkk::clearEkkPointers() {
   this->options_ = NULL;
   this->timer_ = NULL;
+  this->interrupt_flag_ = NULL;
+  this->callback_ = NULL;
 }
 
 void HEkk::clearEkkLp() {
@@ -133,6 +136,7 @@ void HEkk::clearEkkData() {
 
   this->cost_scale_ = 1;
   this->iteration_count_ = 0;
+  this->work_units_ = 0;
   this->dual_simplex_cleanup_level_ = 0;
   this->dual_simplex_phase1_cleanup_level_ = 0;
 
@@ -279,6 +283,7 @@ void HotStart::clear() {
   this->valid = false;
   this->refactor_info.clear();
   this->nonbasicMove.clear();
+  this->dual_edge_weight.clear();
 }
 
 void HEkk::clearHotStart() {
@@ -286,6 +291,29 @@ void HEkk::clearHotStart() {
   this->simplex_nla_.factor_.refactor_info_.clear();
 }
 
+void HEkk::updateHotStartDualEdgeWeights() {
+  // The hot start is the basis at the most recent INVERT, so the
+  // dual edge weights can only be recorded if there have been no
+  // basis changes since
+  if (!this->status_.has_dual_steepest_edge_weights ||
+      !this->status_.has_fresh_invert)
+    return;
+  const HighsInt num_row = this->lp_.num_row_;
+  const vector<HighsInt>& pivot_var = this->hot_start_.refactor_info.pivot_var;
+  if ((HighsInt)pivot_var.size() != num_row) return;
+  // The weights are held in the order of the INVERT pivots, since
+  // this is the order of the basic variables when hot starting
+  const vector<HighsInt>& basicIndex = this->basis_.basicIndex_;
+  this->scattered_dual_edge_weight_.resize(this->lp_.num_col_ + num_row);
+  for (HighsInt i = 0; i < num_row; i++)
+    this->scattered_dual_edge_weight_[basicIndex[i]] =
+        this->dual_edge_weight_[i];
+  this->hot_start_.dual_edge_weight.resize(num_row);
+  for (HighsInt k = 0; k < num_row; k++)
+    this->hot_start_.dual_edge_weight[k] =
+        this->scattered_dual_edge_weight_[pivot_var[k]];
+}
+
 void HEkk::invalidate() {
   this->status_.initialised_for_new_lp = false;
   assert(!this->status_.is_dualised);
@@ -331,6 +359,9 @@ void HEkk::updateStatus(LpAction action) {
       this->clearHotStart();
       break;
     case LpAction::kNewCosts:
+      // Changes to costs or bounds don't affect the basis matrix, so
+      // its factorization, the dual edge weights and the hot start
+      // are retained for re-solving from the current basis
       this->status_.has_fresh_rebuild = false;
       this->status_.has_dual_objective_value = false;
       this->status_.has_primal_objective_value = false;
@@ -447,6 +478,11 @@ void HEkk::moveLp(HighsLpSolverObject& solver_object) {
   // HighsOptions and HighsTimer members of the Highs class that are
   // communicated by reference via the HighsLpSolverObject instance.
   this->setPointers(&solver_object.options_, &solver_object.timer_);
+  // Also pick up any flag by which another thread can interrupt the
+  // solve
+  this->interrupt_flag_ = solver_object.interrupt_flag_;
+  // ... and the user callback
+  this->callback_ = solver_object.callback_;
   // Initialise Ekk if this has not been done. Ekk isn't initialised
   // if moveLp hasn't been called for this instance of HiGHS, or if
   // the Ekk instance is junked due to removing rows from the LP
@@ -1530,6 +1566,15 @@ HighsStatus HEkk::initialiseSimplexLpBasisAndFactor(
   }
 
   if (!status_.has_invert) {
+    // Known dual edge weights (from a hot start or frozen basis) must
+    // be permuted according to INVERT, as in getNonsingularInverse
+    const bool permute_edge_weights = status_.has_dual_steepest_edge_weights;
+    if (permute_edge_weights) {
+      scattered_dual_edge_weight_.resize(lp_.num_col_ + lp_.num_row_);
+      for (HighsInt i = 0; i < lp_.num_row_; i++)
+        scattered_dual_edge_weight_[basis_.basicIndex_[i]] =
+            dual_edge_weight_[i];
+    }
     const HighsInt rank_deficiency = computeFactor();
     if (rank_deficiency) {
       // Basis is rank deficient
@@ -1553,6 +1598,11 @@ HighsStatus HEkk::initialiseSimplexLpBasisAndFactor(
       status_.has_basis = true;
       status_.has_invert = true;
       status_.has_fresh_invert = true;
+    } else if (permute_edge_weights) {
+      for (HighsInt i = 0; i < lp_.num_row_; i++)
+        dual_edge_weight_[i] =
+            scattered_dual_edge_weight_[basis_.basicIndex_[i]];
+      updateHotStartDualEdgeWeights();
     }
     // Record the synthetic clock for INVERT, and zero it for UPDATE
     resetSyntheticClock();
@@ -1897,6 +1947,7 @@ bool HEkk::getNonsingularInverse(const HighsInt solve_phase) {
   for (HighsInt i = 0; i < lp_.num_row_; i++)
     dual_edge_weight_[i] = scattered_dual_edge_weight_[basicIndex[i]];
   analysis_.simplexTimerStop(PermWtClock);
+  updateHotStartDualEdgeWeights();
   return true;
 }
 
@@ -2042,10 +2093,14 @@ HighsInt HEkk::computeFactor() {
   analysis_.simplexTimerStart(InvertClock);
   const HighsInt rank_deficiency = simplex_nla_.invert();
   analysis_.simplexTimerStop(InvertClock);
+  work_units_ += kHighsWorkUnitsPerTick * simplex_nla_.build_synthetic_tick_;
   //
   // Set up hot start information
   hot_start_.refactor_info = simplex_nla_.factor_.refactor_info_;
   hot_start_.nonbasicMove = basis_.nonbasicMove_;
+  // Any dual edge weights are recorded once they have been permuted
+  // according to INVERT
+  hot_start_.dual_edge_weight.clear();
   hot_start_.valid = true;
 
   if (analysis_.analyse_factor_data)
@@ -2226,7 +2281,16 @@ void HEkk::updateDualSteepestEdgeWeights(
   const bool use_row_indices =
       simplex_nla_.sparseLoopStyle(column_count, num_row, to_entry);
   const bool convert_to_scaled_space = !simplex_in_scaled_space_;
+  // Prefetching is only of value when the rows are indexed
+  const HighsInt prefetch_distance =
+      use_row_indices ? options_->simplex_prefetch_distance : 0;
   for (HighsInt iEntry = 0; iEntry < to_entry; iEntry++) {
+    if (prefetch_distance && iEntry + prefetch_distance < to_entry) {
+      const HighsInt prefetch_row = variable_index[iEntry + prefetch_distance];
+      highsPrefetch(&column_array[prefetch_row]);
+      highsPrefetch(&dual_steepest_edge_array[prefetch_row]);
+      highsPrefetch(&dual_edge_weight_[prefetch_row]);
+    }
     const HighsInt iRow = use_row_indices ? variable_index[iEntry] : iEntry;
     double aa_iRow = column_array[iRow];
     if (!aa_iRow) continue;
@@ -2293,6 +2357,11 @@ void HEkk::resetSyntheticClock() {
   this->total_synthetic_tick_ = 0;
 }
 
+void HEkk::addSyntheticTick(const double synthetic_tick) {
+  this->total_synthetic_tick_ += synthetic_tick;
+  this->work_units_ += kHighsWorkUnitsPerTick * synthetic_tick;
+}
+
 void HEkk::initialisePartitionedRowwiseMatrix() {
   if (status_.has_ar_matrix) return;
   analysis_.simplexTimerStart(matrixSetupClock);
@@ -3448,13 +3517,38 @@ bool HEkk::bailoutOnTimeIterations() {
     assert(model_status_ == HighsModelStatus::kTimeLimit ||
            model_status_ == HighsModelStatus::kIterationLimit ||
            model_status_ == HighsModelStatus::kObjectiveBound ||
-           model_status_ == HighsModelStatus::kObjectiveTarget);
+           model_status_ == HighsModelStatus::kObjectiveTarget ||
+           model_status_ == HighsModelStatus::kInterrupt);
   } else if (timer_->readRunHighsClock() > options_->time_limit) {
     solve_bailout_ = true;
     model_status_ = HighsModelStatus::kTimeLimit;
+  } else if (work_units_ > options_->work_limit) {
+    // The work limit is a deterministic surrogate for the time limit
+    solve_bailout_ = true;
+    model_status_ = HighsModelStatus::kTimeLimit;
+  } else if (interrupt_flag_ &&
+             interrupt_flag_->load(std::memory_order_relaxed)) {
+    // Interrupted by another thread, so bail out as if the time limit
+    // has been reached
+    solve_bailout_ = true;
+    model_status_ = HighsModelStatus::kTimeLimit;
   } else if (iteration_count_ >= options_->simplex_iteration_limit) {
     solve_bailout_ = true;
     model_status_ = HighsModelStatus::kIterationLimit;
+  } else if (callback_ &&
+             callback_->callbackActive(kCallbackSimplexIteration)) {
+    callback_->clearHighsCallbackDataOut();
+    callback_->data_out.running_time = timer_->readRunHighsClock();
+    callback_->data_out.simplex_iteration_count = iteration_count_;
+    callback_->data_out.objective_function_value =
+        exit_algorithm_ == SimplexAlgorithm::kPrimal
+            ? info_.updated_primal_objective_value
+            : info_.updated_dual_objective_value;
+    if (callback_->callbackAction(kCallbackSimplexIteration,
+                                  "Simplex iteration")) {
+      solve_bailout_ = true;
+      model_status_ = HighsModelStatus::kInterrupt;
+    }
   }
   return solve_bailout_;
 }
@@ -3481,7 +3575,8 @@ HighsStatus HEkk::returnFromSolve(const HighsStatus return_status) {
     assert(model_status_ == HighsModelStatus::kTimeLimit ||
            model_status_ == HighsModelStatus::kIterationLimit ||
            model_status_ == HighsModelStatus::kObjectiveBound ||
-           model_status_ == HighsModelStatus::kObjectiveTarget);
+           model_status_ == HighsModelStatus::kObjectiveTarget ||
+           model_status_ == HighsModelStatus::kInterrupt);
   }
   // Check that returnFromSolve has not already been called: it should
   // be called exactly once per solve
@@ -3567,7 +3662,8 @@ HighsStatus HEkk::returnFromSolve(const HighsStatus return_status) {
     case HighsModelStatus::kObjectiveTarget:
     case HighsModelStatus::kTimeLimit:
     case HighsModelStatus::kIterationLimit:
-    case HighsModelStatus::kUnknown: {
+    case HighsModelStatus::kUnknown:
+    case HighsModelStatus::kInterrupt: {
       // Simplex has failed to conclude a model property. Either it
       // has bailed out due to reaching the objecive bound, target,
       // time or iteration limit, or it has not been set (cycling is
@@ -16,6 +16,9 @@
 #ifndef SIMPLEX_HEKK_H_
 #define SIMPLEX_HEKK_H_
 
+#include <atomic>
+
+#include "lp_data/HighsCallback.h"
 #include "simplex/HSimplexNla.h"
 #include "simplex/HighsSimplexAnalysis.h"
 #include "util/HSet.h"
@@ -54,6 +57,7 @@ class HEkk {
   void setNlaPointersForTrans(const HighsLp& lp);
   void setNlaRefactorInfo();
   void clearHotStart();
+  void updateHotStartDualEdgeWeights();
   void btran(HVector& rhs, const double expected_density);
   void ftran(HVector& rhs, const double expected_density);
 
@@ -135,6 +139,8 @@ class HEkk {
   // Data members
   HighsOptions* options_;
   HighsTimer* timer_;
+  const std::atomic<bool>* interrupt_flag_ = nullptr;
+  HighsCallback* callback_ = nullptr;
   HighsSimplexAnalysis analysis_;
 
   HighsLp lp_;
@@ -158,6 +164,9 @@ class HEkk {
   double cost_perturbation_base_;
   double cost_perturbation_max_abs_cost_;
   HighsInt iteration_count_ = 0;
+  // Deterministic work units, accumulated from the synthetic ticks of
+  // INVERT and of the FTRAN/BTRAN operations in each iteration
+  double work_units_ = 0;
   HighsInt dual_simplex_cleanup_level_ = 0;
   HighsInt dual_simplex_phase1_cleanup_level_ = 0;
 
@@ -237,6 +246,7 @@ class HEkk {
   void updateDualDevexWeights(const HVector* column,
                               const double new_pivotal_edge_weight);
   void resetSyntheticClock();
+  void addSyntheticTick(const double synthetic_tick);
   void allocateWorkAndBaseArrays();
   void initialiseCost(const SimplexAlgorithm algorithm,
                       const HighsInt solve_phase, const bool perturb = false);
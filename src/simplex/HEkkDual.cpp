@@ -22,6 +22,7 @@
 #include <cstring>
 #include <iostream>
 #include <set>
+#include <thread>
 
 #include "lp_data/HighsLpUtils.h"
 #include "parallel/HighsParallel.h"
@@ -186,6 +187,9 @@ HighsStatus HEkkDual::solve(const bool pass_force_phase2) {
       assert(!status.has_dual_steepest_edge_weights);
     }
   }
+  // Weights for the initial basis can be used to hot start a
+  // subsequent solve
+  ekk_instance_.updateHotStartDualEdgeWeights();
   // Resize the copy of scattered edge weights for backtracking
   info.backtracking_basis_edge_weight_.resize(solver_num_tot);
 
@@ -565,6 +569,20 @@ void HEkkDual::initialiseSolve() {
   interpretDualEdgeWeightStrategy(
       ekk_instance_.info_.dual_edge_weight_strategy);
 
+  // Overlap the FTRANs and updates in serial dual simplex iterations
+  // if there are threads to do so. Not when the parallel option is
+  // off, not when the threads oversubscribe the hardware, since the
+  // waits for stolen tasks then dominate, and not when analysing,
+  // since the analysis records and timers aren't thread safe
+  const HighsInt num_threads = highs::parallel::num_threads();
+  overlap_iterate =
+      ekk_instance_.info_.simplex_strategy == kSimplexStrategyDualPlain &&
+      ekk_instance_.options_->parallel != kHighsOffString &&
+      num_threads > 1 &&
+      num_threads <= (HighsInt)std::thread::hardware_concurrency() &&
+      !analysis->analyse_simplex_summary_data &&
+      !analysis->analyse_simplex_time;
+
   // Initialise model and run status values
   ekk_instance_.model_status_ = HighsModelStatus::kNotset;
   ekk_instance_.solve_bailout_ = false;
@@ -1201,14 +1219,26 @@ void HEkkDual::iterate() {
   if (isBadBasisChange()) return;
 
   analysis->simplexTimerStart(IterateFtranClock);
-  updateFtranBFRT();
+  if (overlap_iterate) {
+    // The three FTRANs are independent, so perform FTRAN-BFRT and
+    // FTRAN-DSE as tasks while computing the pivotal column
+    highs::parallel::spawn([&]() { updateFtranBFRT(); });
+    const bool use_dse = edge_weight_mode == EdgeWeightMode::kSteepestEdge;
+    if (use_dse) highs::parallel::spawn([&]() { updateFtranDSE(&row_ep); });
+    updateFtran();
+    if (use_dse) highs::parallel::sync();
+    highs::parallel::sync();
+  } else {
+    updateFtranBFRT();
 
-  // updateFtran(); computes the pivotal column in the data structure "column"
-  updateFtran();
+    // updateFtran(); computes the pivotal column in the data structure
+    // "column"
+    updateFtran();
 
-  // updateFtranDSE performs the DSE FTRAN on pi_p
-  if (edge_weight_mode == EdgeWeightMode::kSteepestEdge)
-    updateFtranDSE(&row_ep);
+    // updateFtranDSE performs the DSE FTRAN on pi_p
+    if (edge_weight_mode == EdgeWeightMode::kSteepestEdge)
+      updateFtranDSE(&row_ep);
+  }
   analysis->simplexTimerStop(IterateFtranClock);
 
   // updateVerify() Checks row-wise pivot against column-wise pivot for
@@ -1217,17 +1247,27 @@ void HEkkDual::iterate() {
   updateVerify();
   analysis->simplexTimerStop(IterateVerifyClock);
 
-  // updateDual() Updates the dual values
-  analysis->simplexTimerStart(IterateDualClock);
-  updateDual();
-  analysis->simplexTimerStop(IterateDualClock);
-
-  //  debugUpdatedObjectiveValue(ekk_instance_, algorithm, solve_phase, "Before
-  //  updatePrimal");
-  // updatePrimal(&row_ep); Updates the primal values and the edge weights
-  analysis->simplexTimerStart(IteratePrimalClock);
-  updatePrimal(&row_ep);
-  analysis->simplexTimerStop(IteratePrimalClock);
+  if (overlap_iterate) {
+    // The dual values and dual objective are independent of the
+    // primal values and edge weights, so update them as a task while
+    // updating the primal values and edge weights
+    highs::parallel::spawn([&]() { updateDual(); });
+    updatePrimal(&row_ep);
+    highs::parallel::sync();
+  } else {
+    // updateDual() Updates the dual values
+    analysis->simplexTimerStart(IterateDualClock);
+    updateDual();
+    analysis->simplexTimerStop(IterateDualClock);
+
+    //  debugUpdatedObjectiveValue(ekk_instance_, algorithm, solve_phase,
+    //  "Before updatePrimal");
+    // updatePrimal(&row_ep); Updates the primal values and the edge
+    // weights
+    analysis->simplexTimerStart(IteratePrimalClock);
+    updatePrimal(&row_ep);
+    analysis->simplexTimerStop(IteratePrimalClock);
+  }
   // After primal update in dual simplex the primal objective value is not known
   ekk_instance_.status_.has_primal_objective_value = false;
   //  debugUpdatedObjectiveValue(ekk_instance_, algorithm, solve_phase, "After
@@ -1850,22 +1890,71 @@ void HEkkDual::chooseColumnSlice(HVector* row_ep) {
     analysis->operationRecordAfter(kSimplexNlaPriceAp, row_ap_count);
   }
 
-  // Join CC1 results here
+  analysis->simplexTimerStop(PriceChuzc1Clock);
+
+  // Determine the CC1 results over row_ep and the slices
+  double work_theta = dualRow.workTheta;
+  HighsInt full_count = dualRow.workCount;
   for (HighsInt i = 0; i < slice_num; i++) {
-    dualRow.chooseJoinpack(&slice_dualRow[i]);
+    work_theta = std::min(work_theta, slice_dualRow[i].workTheta);
+    full_count += slice_dualRow[i].workCount;
   }
 
-  analysis->simplexTimerStop(PriceChuzc1Clock);
-
   // Infeasible we created before
   variable_in = -1;
-  if (dualRow.workTheta <= 0 || dualRow.workCount == 0) {
+  if (work_theta <= 0 || full_count == 0) {
     rebuild_reason = kRebuildReasonPossiblyDualUnbounded;
     return;
   }
 
+  // Reduce the candidates by large step BFRT slice by slice, rather
+  // than after joining them. Each slice accumulates the count and
+  // change of the candidates selected by each pass, and the passes
+  // are merged in a fixed order so that the reduction doesn't depend
+  // on the scheduling of the tasks
+  analysis->simplexTimerStart(Chuzc3Clock);
+  const double initial_select_theta = 10 * work_theta + 1e-7;
+  highs::parallel::spawn(
+      [&]() { dualRow.chooseLargeStepPasses(initial_select_theta); });
+  highs::parallel::for_each(0, slice_num, [&](HighsInt start, HighsInt end) {
+    for (HighsInt i = start; i < end; i++)
+      slice_dualRow[i].chooseLargeStepPasses(initial_select_theta);
+  });
+  highs::parallel::sync();
+
+  const double total_delta = fabs(delta_primal);
+  double total_change = 0;
+  HighsInt select_count = 0;
+  double select_theta = initial_select_theta;
+  for (HighsInt pass = 0;; pass++) {
+    for (HighsInt i = -1; i < slice_num; i++) {
+      const HEkkDualRow& row = i < 0 ? dualRow : slice_dualRow[i];
+      if (pass >= (HighsInt)row.pass_count.size()) continue;
+      select_count += row.pass_count[pass];
+      total_change += row.pass_change[pass];
+    }
+    if (total_change >= total_delta || select_count == full_count) break;
+    select_theta *= 10;
+  }
+
+  highs::parallel::spawn(
+      [&]() { dualRow.chooseLargeStepReduce(select_theta); });
+  highs::parallel::for_each(0, slice_num, [&](HighsInt start, HighsInt end) {
+    for (HighsInt i = start; i < end; i++)
+      slice_dualRow[i].chooseLargeStepReduce(select_theta);
+  });
+  highs::parallel::sync();
+
+  // Join the reduced CC1 results here
+  for (HighsInt i = 0; i < slice_num; i++) {
+    dualRow.chooseJoinpack(&slice_dualRow[i]);
+  }
+  assert(dualRow.workCount == select_count);
+  analysis->simplexTimerStop(Chuzc3Clock);
+
   // Choose column 2, This only happens if didn't go out
-  HighsInt return_code = dualRow.chooseFinal();
+  const bool reduced = true;
+  HighsInt return_code = dualRow.chooseFinal(reduced);
   if (return_code) {
     // Only returns -1, if not zero
     assert(return_code == -1);
@@ -2171,8 +2260,8 @@ void HEkkDual::updatePrimal(HVector* DSE_Vector) {
   // Whether or not dual steepest edge weights are being used, have to
   // add in DSE_Vector->synthetic_tick_ since this contains the
   // contribution from forming row_ep = B^{-T}e_p.
-  ekk_instance_.total_synthetic_tick_ += col_aq.synthetic_tick;
-  ekk_instance_.total_synthetic_tick_ += DSE_Vector->synthetic_tick;
+  ekk_instance_.addSyntheticTick(col_aq.synthetic_tick);
+  ekk_instance_.addSyntheticTick(DSE_Vector->synthetic_tick);
 }
 
 // Record the shift in the cost of a particular column
@@ -2746,7 +2835,8 @@ bool HEkkDual::bailoutOnDualObjective() {
     // reasons
     assert(ekk_instance_.model_status_ == HighsModelStatus::kTimeLimit ||
            ekk_instance_.model_status_ == HighsModelStatus::kIterationLimit ||
-           ekk_instance_.model_status_ == HighsModelStatus::kObjectiveBound);
+           ekk_instance_.model_status_ == HighsModelStatus::kObjectiveBound ||
+           ekk_instance_.model_status_ == HighsModelStatus::kInterrupt);
   } else if (ekk_instance_.lp_.sense_ == ObjSense::kMinimize &&
              solve_phase == kSolvePhase2) {
     if (ekk_instance_.info_.updated_dual_objective_value >
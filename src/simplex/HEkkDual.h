@@ -414,6 +414,9 @@ class HEkkDual {
   // Options
   EdgeWeightMode edge_weight_mode;
   bool allow_dual_steepest_edge_to_devex_switch;
+  // Overlap the independent operations of a serial dual iteration
+  // as tasks
+  bool overlap_iterate;
 
   double Tp;  // Tolerance for primal
   double primal_feasibility_tolerance;
@@ -668,8 +668,8 @@ void HEkkDual::majorUpdateFtranParallel() {
     MFinish* finish = &multi_finish[iFn];
     HVector* Col = finish->col_aq;
     HVector* Row = finish->row_ep;
-    ekk_instance_.total_synthetic_tick_ += Col->synthetic_tick;
-    ekk_instance_.total_synthetic_tick_ += Row->synthetic_tick;
+    ekk_instance_.addSyntheticTick(Col->synthetic_tick);
+    ekk_instance_.addSyntheticTick(Row->synthetic_tick);
   }
 
   // Update rates
@@ -22,6 +22,7 @@
 
 #include "pdqsort/pdqsort.h"
 #include "simplex/SimplexTimer.h"
+#include "util/HighsPrefetch.h"
 
 using std::fill_n;
 using std::make_pair;
@@ -327,8 +328,20 @@ void HEkkDualRHS::updatePrimal(HVector* column, double theta) {
 
   bool updatePrimal_inDense = columnCount < 0 || columnCount > 0.4 * numRow;
 
+  // Prefetching is only of value when the rows are indexed
+  const HighsInt prefetch_distance =
+      updatePrimal_inDense ? 0
+                           : ekk_instance_.options_->simplex_prefetch_distance;
   const HighsInt to_entry = updatePrimal_inDense ? numRow : columnCount;
   for (HighsInt iEntry = 0; iEntry < to_entry; iEntry++) {
+    if (prefetch_distance && iEntry + prefetch_distance < to_entry) {
+      const HighsInt prefetch_row = variable_index[iEntry + prefetch_distance];
+      highsPrefetch(&columnArray[prefetch_row]);
+      highsPrefetch(&baseValue[prefetch_row]);
+      highsPrefetch(&baseLower[prefetch_row]);
+      highsPrefetch(&baseUpper[prefetch_row]);
+      highsPrefetch(&work_infeasibility[prefetch_row]);
+    }
     const HighsInt iRow =
         updatePrimal_inDense ? iEntry : variable_index[iEntry];
     baseValue[iRow] -= theta * columnArray[iRow];
@@ -22,6 +22,7 @@
 #include "simplex/HSimplexDebug.h"
 #include "simplex/SimplexTimer.h"
 #include "util/HighsCDouble.h"
+#include "util/HighsPrefetch.h"
 #include "util/HighsSort.h"
 
 using std::make_pair;
@@ -95,7 +96,14 @@ void HEkkDualRow::choosePossible() {
   workTheta = kHighsInf;
   workCount = 0;
 
+  const HighsInt prefetch_distance =
+      ekk_instance_.options_->simplex_prefetch_distance;
   for (HighsInt i = 0; i < packCount; i++) {
+    if (prefetch_distance && i + prefetch_distance < packCount) {
+      const HighsInt prefetch_col = packIndex[i + prefetch_distance];
+      highsPrefetch(&workMove[prefetch_col]);
+      highsPrefetch(&workDual[prefetch_col]);
+    }
     const HighsInt iCol = packIndex[i];
     const HighsInt move = workMove[iCol];
     const double alpha = packValue[i] * move_out * move;
@@ -119,12 +127,57 @@ void HEkkDualRow::chooseJoinpack(const HEkkDualRow* otherRow) {
   workTheta = min(workTheta, otherRow->workTheta);
 }
 
-HighsInt HEkkDualRow::chooseFinal() {
+void HEkkDualRow::chooseLargeStepPasses(const double initial_select_theta) {
+  /**
+   * For each possible candidate, find the pass of the large step BFRT
+   * in chooseFinal that would select it, and accumulate the number of
+   * candidates and total change for each pass
+   */
+  pass_count.clear();
+  pass_change.clear();
+  for (HighsInt i = 0; i < workCount; i++) {
+    const HighsInt iCol = workData[i].first;
+    const double alpha = workData[i].second;
+    const double tight = workMove[iCol] * workDual[iCol];
+    // Replicate the growth of selectTheta in chooseFinal
+    HighsInt pass = 0;
+    double selectTheta = initial_select_theta;
+    while (alpha * selectTheta < tight) {
+      selectTheta *= 10;
+      pass++;
+    }
+    if (pass >= (HighsInt)pass_count.size()) {
+      pass_count.resize(pass + 1, 0);
+      pass_change.resize(pass + 1, 0);
+    }
+    pass_count[pass]++;
+    pass_change[pass] += workRange[iCol] * alpha;
+  }
+}
+
+void HEkkDualRow::chooseLargeStepReduce(const double select_theta) {
+  /**
+   * Move the possible candidates selected by the large step BFRT
+   * pass with the given select_theta to the start of workData,
+   * retaining their order, and reduce workCount accordingly
+   */
+  HighsInt fullCount = workCount;
+  workCount = 0;
+  for (HighsInt i = 0; i < fullCount; i++) {
+    const HighsInt iCol = workData[i].first;
+    const double alpha = workData[i].second;
+    const double tight = workMove[iCol] * workDual[iCol];
+    if (alpha * select_theta >= tight) swap(workData[workCount++], workData[i]);
+  }
+}
+
+HighsInt HEkkDualRow::chooseFinal(const bool reduced) {
   /**
    * Chooses the entering variable via BFRT and EXPAND
    *
    * It will
-   * (1) reduce the candidates as a small collection
+   * (1) reduce the candidates as a small collection - unless already
+   *     reduced slice by slice
    * (2) choose by BFRT by going over break points
    * (3) choose final by alpha
    * (4) determine final flip variables
@@ -141,22 +194,32 @@ HighsInt HEkkDualRow::chooseFinal() {
              (int)ekk_instance_.iteration_count_);
   }
   HighsInt fullCount = workCount;
-  workCount = 0;
-  double totalChange = 0;
-  const double totalDelta = fabs(workDelta);
-  double selectTheta = 10 * workTheta + 1e-7;
-  for (;;) {
-    for (HighsInt i = workCount; i < fullCount; i++) {
-      HighsInt iCol = workData[i].first;
-      double alpha = workData[i].second;
-      double tight = workMove[iCol] * workDual[iCol];
-      if (alpha * selectTheta >= tight) {
-        swap(workData[workCount++], workData[i]);
-        totalChange += workRange[iCol] * alpha;
+  if (!reduced) {
+    workCount = 0;
+    double totalChange = 0;
+    const double totalDelta = fabs(workDelta);
+    double selectTheta = 10 * workTheta + 1e-7;
+    const HighsInt prefetch_distance =
+        ekk_instance_.options_->simplex_prefetch_distance;
+    for (;;) {
+      for (HighsInt i = workCount; i < fullCount; i++) {
+        if (prefetch_distance && i + prefetch_distance < fullCount) {
+          const HighsInt prefetch_col = workData[i + prefetch_distance].first;
+          highsPrefetch(&workMove[prefetch_col]);
+          highsPrefetch(&workDual[prefetch_col]);
+          highsPrefetch(&workRange[prefetch_col]);
+        }
+        HighsInt iCol = workData[i].first;
+        double alpha = workData[i].second;
+        double tight = workMove[iCol] * workDual[iCol];
+        if (alpha * selectTheta >= tight) {
+          swap(workData[workCount++], workData[i]);
+          totalChange += workRange[iCol] * alpha;
+        }
       }
+      selectTheta *= 10;
+      if (totalChange >= totalDelta || workCount == fullCount) break;
     }
-    selectTheta *= 10;
-    if (totalChange >= totalDelta || workCount == fullCount) break;
   }
   analysis->simplexTimerStop(Chuzc3Clock);
   // 2. Choose by small step BFRT
@@ -562,15 +625,25 @@ void HEkkDualRow::updateFlip(HVector* bfrtColumn) {
 void HEkkDualRow::updateDual(double theta) {
   analysis->simplexTimerStart(UpdateDualClock);
   double* workDual = &ekk_instance_.info_.workDual_[0];
+  const double* workValue = &ekk_instance_.info_.workValue_[0];
+  const int8_t* nonbasicFlag = &ekk_instance_.basis_.nonbasicFlag_[0];
+  const HighsInt prefetch_distance =
+      ekk_instance_.options_->simplex_prefetch_distance;
   double dual_objective_value_change = 0;
   for (HighsInt i = 0; i < packCount; i++) {
+    if (prefetch_distance && i + prefetch_distance < packCount) {
+      const HighsInt prefetch_col = packIndex[i + prefetch_distance];
+      highsPrefetch(&workDual[prefetch_col]);
+      highsPrefetch(&workValue[prefetch_col]);
+      highsPrefetch(&nonbasicFlag[prefetch_col]);
+    }
     workDual[packIndex[i]] -= theta * packValue[i];
     // Identify the change to the dual objective
     HighsInt iCol = packIndex[i];
     const double delta_dual = theta * packValue[i];
-    const double local_value = ekk_instance_.info_.workValue_[iCol];
+    const double local_value = workValue[iCol];
     double local_dual_objective_change =
-        ekk_instance_.basis_.nonbasicFlag_[iCol] * (-local_value * delta_dual);
+        nonbasicFlag[iCol] * (-local_value * delta_dual);
     local_dual_objective_change *= ekk_instance_.cost_scale_;
     dual_objective_value_change += local_dual_objective_change;
   }
@@ -77,6 +77,22 @@ class HEkkDualRow {
   void chooseJoinpack(
       const HEkkDualRow* otherRow  //!< Other row to join with this
   );
+  /**
+   * @brief Accumulate the number of possible candidates and their
+   * total change for each pass of the large step BFRT in
+   * chooseFinal, so that slices can be reduced in parallel
+   */
+  void chooseLargeStepPasses(
+      const double initial_select_theta  //!< selectTheta for the first pass
+  );
+
+  /**
+   * @brief Reduce the possible candidates to those selected by the
+   * large step BFRT pass with the given selectTheta
+   */
+  void chooseLargeStepReduce(const double select_theta  //!< Final selectTheta
+  );
+
   /**
    * @brief Chooses the entering variable via BFRT and EXPAND
    *
@@ -84,7 +100,9 @@ class HEkkDualRow {
    * perturbation not being relatively too small, returns positive if
    * dual uboundedness is suspected
    */
-  HighsInt chooseFinal();
+  HighsInt chooseFinal(
+      const bool reduced = false  //!< Candidates reduced by large step BFRT
+  );
 
   /**
    * @brief Identifies the groups of degenerate nodes in BFRT after a
@@ -193,6 +211,8 @@ class HEkkDualRow {
       workData;  //!< Index-Value pairs for ratio test
   std::vector<HighsInt>
       workGroup;  //!< Pointers into workData for degenerate nodes in BFRT
+  std::vector<HighsInt> pass_count;  //!< Candidates for each large step pass
+  std::vector<double> pass_change;   //!< Total change for each large step pass
 
   // Independent identifiers for heap-based sort in BFRT
   HighsInt alt_workCount = 0;
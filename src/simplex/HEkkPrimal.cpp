@@ -15,6 +15,7 @@
  */
 #include "simplex/HEkkPrimal.h"
 
+#include "parallel/HighsParallel.h"
 #include "pdqsort/pdqsort.h"
 #include "simplex/HEkkDual.h"
 #include "simplex/SimplexTimer.h"
@@ -374,6 +375,67 @@ void HEkkPrimal::initialiseInstance() {
       max_num_hyper_chuzc_candidates, num_tot,
       ekk_instance_.options_->output_flag,
       ekk_instance_.options_->log_options.log_file_stream, debug);
+  // Set up the slices for parallel PRICE and CHUZC if the parallel
+  // option is on and there are threads to use
+  if (ekk_instance_.options_->parallel == kHighsOnString) {
+    const HighsInt num_threads = highs::parallel::num_threads();
+    if (num_threads > 1)
+      initSlice(
+          min(num_threads, ekk_instance_.options_->simplex_max_concurrency));
+  }
+}
+
+void HEkkPrimal::initSlice(const HighsInt initial_num_slice) {
+  slice_num = min(initial_num_slice, kHighsSlicedLimit);
+  if (num_col < slice_num) {
+    // Too few columns to be worth slicing
+    slice_num = 0;
+    return;
+  }
+  // Partition the columns so that the slices of the matrix have
+  // similar numbers of nonzeros, as in HEkkDual::initSlice
+  const HighsSparseMatrix& a_matrix = ekk_instance_.lp_.a_matrix_;
+  assert(a_matrix.isColwise());
+  const HighsInt* a_start = &a_matrix.start_[0];
+  const double sliced_count = a_start[num_col] / (double)slice_num;
+  slice_start.resize(slice_num + 1);
+  slice_start[0] = 0;
+  for (HighsInt i = 0; i < slice_num - 1; i++) {
+    HighsInt end_col = slice_start[i] + 1;  // At least one column
+    HighsInt end_el = a_start[end_col];
+    HighsInt stop_el = (i + 1) * sliced_count;
+    while (end_el < stop_el) end_el = a_start[++end_col];
+    slice_start[i + 1] = end_col;
+    if (end_col >= num_col) {
+      slice_num = i;  // SHRINK
+      break;
+    }
+  }
+  if (slice_num < 2) {
+    // Too few columns to be worth slicing
+    slice_num = 0;
+    return;
+  }
+  slice_start[slice_num] = num_col;
+
+  // Set up the matrix and row_ap slices
+  slice_a_matrix.resize(slice_num);
+  slice_ar_matrix.resize(slice_num);
+  slice_row_ap.resize(slice_num);
+  for (HighsInt i = 0; i < slice_num; i++) {
+    const HighsInt from_col = slice_start[i];
+    const HighsInt to_col = slice_start[i + 1] - 1;
+    slice_a_matrix[i].createSlice(a_matrix, from_col, to_col);
+    slice_ar_matrix[i].createRowwise(slice_a_matrix[i]);
+    slice_row_ap[i].setup(to_col - from_col + 1);
+  }
+
+  // Partition the variables for CHUZC into parts of equal size
+  chuzc_start.resize(slice_num + 1);
+  for (HighsInt i = 0; i <= slice_num; i++)
+    chuzc_start[i] = ((int64_t)i * num_tot) / slice_num;
+  chuzc_variable_in.resize(slice_num);
+  chuzc_best_measure.resize(slice_num);
 }
 
 void HEkkPrimal::initialiseSolve() {
@@ -1050,15 +1112,10 @@ void HEkkPrimal::chooseColumn(const bool hyper_sparse) {
       }
     }
     // Now look at other columns
-    for (HighsInt iCol = 0; iCol < num_tot; iCol++) {
-      double dual_infeasibility = -nonbasicMove[iCol] * workDual[iCol];
-      if (dual_infeasibility > dual_feasibility_tolerance &&
-          dual_infeasibility * dual_infeasibility >
-              best_measure * edge_weight_[iCol]) {
-        variable_in = iCol;
-        best_measure =
-            dual_infeasibility * dual_infeasibility / edge_weight_[iCol];
-      }
+    if (slice_num) {
+      chooseColumnSlice(best_measure);
+    } else {
+      chooseColumnRange(0, num_tot, variable_in, best_measure);
     }
     analysis->simplexTimerStop(ChuzcPrimalClock);
   }
@@ -1067,6 +1124,45 @@ void HEkkPrimal::chooseColumn(const bool hyper_sparse) {
   //	 ekk_instance_.iteration_count_, variable_in, best_measure);
 }
 
+void HEkkPrimal::chooseColumnRange(const HighsInt from_var,
+                                   const HighsInt to_var,
+                                   HighsInt& best_variable,
+                                   double& best_measure) const {
+  const vector<int8_t>& nonbasicMove = ekk_instance_.basis_.nonbasicMove_;
+  const vector<double>& workDual = ekk_instance_.info_.workDual_;
+  for (HighsInt iCol = from_var; iCol < to_var; iCol++) {
+    double dual_infeasibility = -nonbasicMove[iCol] * workDual[iCol];
+    if (dual_infeasibility > dual_feasibility_tolerance &&
+        dual_infeasibility * dual_infeasibility >
+            best_measure * edge_weight_[iCol]) {
+      best_variable = iCol;
+      best_measure =
+          dual_infeasibility * dual_infeasibility / edge_weight_[iCol];
+    }
+  }
+}
+
+void HEkkPrimal::chooseColumnSlice(double& best_measure) {
+  // Find the best variable in each part of the partition in
+  // parallel, and then take the first with the largest measure so
+  // that the choice is that of the serial loop, whatever the
+  // scheduling of the tasks
+  highs::parallel::for_each(0, slice_num, [&](HighsInt start, HighsInt end) {
+    for (HighsInt i = start; i < end; i++) {
+      chuzc_variable_in[i] = -1;
+      chuzc_best_measure[i] = best_measure;
+      chooseColumnRange(chuzc_start[i], chuzc_start[i + 1],
+                        chuzc_variable_in[i], chuzc_best_measure[i]);
+    }
+  });
+  for (HighsInt i = 0; i < slice_num; i++) {
+    if (chuzc_variable_in[i] >= 0 && chuzc_best_measure[i] > best_measure) {
+      variable_in = chuzc_variable_in[i];
+      best_measure = chuzc_best_measure[i];
+    }
+  }
+}
+
 bool HEkkPrimal::useVariableIn() {
   // rebuild_reason = kRebuildReasonPossiblySingularBasis is set if
   // numerical trouble is detected
@@ -1402,8 +1498,14 @@ void HEkkPrimal::assessPivot() {
   //
   // PRICE
   //
-  const bool quad_precision = false;
-  ekk_instance_.tableauRowPrice(quad_precision, row_ep, row_ap);
+  // Disable slices when row_ep is too sparse, as in
+  // HEkkDual::iterateTasks
+  if (slice_num && 1.0 * row_ep.count / num_row >= 0.01) {
+    tableauRowPriceSlice();
+  } else {
+    const bool quad_precision = false;
+    ekk_instance_.tableauRowPrice(quad_precision, row_ep, row_ap);
+  }
 
   // Checks row-wise pivot against column-wise pivot for
   // numerical trouble
@@ -1413,6 +1515,73 @@ void HEkkPrimal::assessPivot() {
   updateVerify();
 }
 
+void HEkkPrimal::tableauRowPriceSlice() {
+  // Perform PRICE for the tableau row slice by slice in parallel,
+  // and then gather the slices of row_ap
+  analysis->simplexTimerStart(PriceClock);
+  HighsSimplexInfo& info = ekk_instance_.info_;
+  const double local_density = 1.0 * row_ep.count / num_row;
+  bool use_col_price;
+  bool use_row_price_w_switch;
+  ekk_instance_.choosePriceTechnique(info.price_strategy, local_density,
+                                     use_col_price, use_row_price_w_switch);
+  if (analysis->analyse_simplex_summary_data) {
+    if (use_col_price) {
+      const double expected_density = 1;
+      analysis->operationRecordBefore(kSimplexNlaPriceAp, row_ep,
+                                      expected_density);
+      analysis->num_col_price++;
+    } else if (use_row_price_w_switch) {
+      analysis->operationRecordBefore(kSimplexNlaPriceAp, row_ep,
+                                      info.row_ep_density);
+      analysis->num_row_price_with_switch++;
+    } else {
+      analysis->operationRecordBefore(kSimplexNlaPriceAp, row_ep,
+                                      info.row_ep_density);
+      analysis->num_row_price++;
+    }
+  }
+  const double row_ap_density = info.row_ap_density;
+  highs::parallel::for_each(0, slice_num, [&](HighsInt start, HighsInt end) {
+    const bool quad_precision = false;
+    for (HighsInt i = start; i < end; i++) {
+      slice_row_ap[i].clear();
+      if (use_col_price) {
+        slice_a_matrix[i].priceByColumn(quad_precision, slice_row_ap[i],
+                                        row_ep);
+      } else if (use_row_price_w_switch) {
+        slice_ar_matrix[i].priceByRowWithSwitch(
+            quad_precision, slice_row_ap[i], row_ep, row_ap_density, 0,
+            kHyperPriceDensity);
+      } else {
+        slice_ar_matrix[i].priceByRow(quad_precision, slice_row_ap[i], row_ep);
+      }
+    }
+  });
+  // The slices have components corresponding to basic variables, so
+  // gather just those for nonbasic variables
+  const vector<int8_t>& nonbasicFlag = ekk_instance_.basis_.nonbasicFlag_;
+  row_ap.clear();
+  for (HighsInt i = 0; i < slice_num; i++) {
+    const HVector& slice_ap = slice_row_ap[i];
+    const HighsInt from_col = slice_start[i];
+    for (HighsInt ix = 0; ix < slice_ap.count; ix++) {
+      const HighsInt iSliceCol = slice_ap.index[ix];
+      const HighsInt iCol = from_col + iSliceCol;
+      if (!nonbasicFlag[iCol]) continue;
+      row_ap.array[iCol] = slice_ap.array[iSliceCol];
+      row_ap.index[row_ap.count++] = iCol;
+    }
+  }
+  // Update the record of average row_ap density
+  const double local_row_ap_density = (double)row_ap.count / num_col;
+  ekk_instance_.updateOperationResultDensity(local_row_ap_density,
+                                             info.row_ap_density);
+  if (analysis->analyse_simplex_summary_data)
+    analysis->operationRecordAfter(kSimplexNlaPriceAp, row_ap);
+  analysis->simplexTimerStop(PriceClock);
+}
+
 void HEkkPrimal::update() {
   // Perform update operations that are independent of phase
   HighsSimplexInfo& info = ekk_instance_.info_;
@@ -1462,7 +1631,7 @@ void HEkkPrimal::update() {
     localReportIter();
     num_flip_since_rebuild++;
     // Update the synthetic clock for UPDATE
-    ekk_instance_.total_synthetic_tick_ += col_aq.synthetic_tick;
+    ekk_instance_.addSyntheticTick(col_aq.synthetic_tick);
     return;
   }
 
@@ -1536,8 +1705,8 @@ void HEkkPrimal::update() {
   localReportIter();
 
   // Update the synthetic clock for UPDATE
-  ekk_instance_.total_synthetic_tick_ += col_aq.synthetic_tick;
-  ekk_instance_.total_synthetic_tick_ += row_ep.synthetic_tick;
+  ekk_instance_.addSyntheticTick(col_aq.synthetic_tick);
+  ekk_instance_.addSyntheticTick(row_ep.synthetic_tick);
 
   // Perform hyper-sparse CHUZC
   hyperChooseColumn();
@@ -42,6 +42,12 @@ class HEkkPrimal {
    * @brief Initialise a primal simplex instance
    */
   void initialiseInstance();
+  /**
+   * @brief Initialise matrix slices and slices of row_ap for
+   * parallel PRICE, and the partition of the variables for parallel
+   * CHUZC
+   */
+  void initSlice(const HighsInt initial_num_slice);
   /**
    * @brief Initialise a primal simplex solve
    */
@@ -54,12 +60,16 @@ class HEkkPrimal {
   void iterate();
   void chuzc();
   void chooseColumn(const bool hyper_sparse = false);
+  void chooseColumnRange(const HighsInt from_var, const HighsInt to_var,
+                         HighsInt& best_variable, double& best_measure) const;
+  void chooseColumnSlice(double& best_measure);
   bool useVariableIn();
   void phase1ChooseRow();
   void chooseRow();
 
   void considerBoundSwap();
   void assessPivot();
+  void tableauRowPriceSlice();
 
   void update();
 
@@ -172,6 +182,15 @@ class HEkkPrimal {
   double max_changed_measure_value;
   HighsInt max_changed_measure_column;
   const bool report_hyper_chuzc = false;
+  // Parallel PRICE and CHUZC data: slice_num = 0 means serial
+  HighsInt slice_num = 0;
+  vector<HighsInt> slice_start;
+  vector<HighsSparseMatrix> slice_a_matrix;
+  vector<HighsSparseMatrix> slice_ar_matrix;
+  vector<HVector> slice_row_ap;
+  vector<HighsInt> chuzc_start;
+  vector<HighsInt> chuzc_variable_in;
+  vector<double> chuzc_best_measure;
   // Solve buffer
   HVector row_ep;
   HVector row_ap;
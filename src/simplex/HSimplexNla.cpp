@@ -42,6 +42,9 @@ void HSimplexNla::setup(const HighsLp* lp, HighsInt* basic_index,
       &factor_a_matrix->value_[0], this->basic_index_, factor_pivot_threshold,
       this->options_->factor_pivot_tolerance, this->options_->highs_debug_level,
       &(this->options_->log_options));
+  const bool parallel = this->options_->parallel == kHighsOnString;
+  this->factor_.setParallelBuild(parallel);
+  this->factor_.setParallelSolve(parallel);
   assert(debugCheckData("After HSimplexNla::setup") == HighsDebugStatus::kOk);
 }
 
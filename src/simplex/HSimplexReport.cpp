@@ -23,12 +23,12 @@ void reportSimplexPhaseIterations(const HighsLogOptions& log_options,
                                   const HighsSimplexInfo& info,
                                   const bool initialise) {
   if (info.run_quiet) return;
-  static HighsInt iteration_count0 = 0;
-  static HighsInt dual_phase1_iteration_count0 = 0;
-  static HighsInt dual_phase2_iteration_count0 = 0;
-  static HighsInt primal_phase1_iteration_count0 = 0;
-  static HighsInt primal_phase2_iteration_count0 = 0;
-  static HighsInt primal_bound_swap0 = 0;
+  static thread_local HighsInt iteration_count0 = 0;
+  static thread_local HighsInt dual_phase1_iteration_count0 = 0;
+  static thread_local HighsInt dual_phase2_iteration_count0 = 0;
+  static thread_local HighsInt primal_phase1_iteration_count0 = 0;
+  static thread_local HighsInt primal_phase2_iteration_count0 = 0;
+  static thread_local HighsInt primal_bound_swap0 = 0;
   if (initialise) {
     iteration_count0 = iteration_count;
     dual_phase1_iteration_count0 = info.dual_phase1_iteration_count;
@@ -19,6 +19,7 @@
 #include <iostream>
 
 #include "lp_data/HConst.h"
+#include "parallel/HighsParallel.h"
 #include "pdqsort/pdqsort.h"
 #include "util/FactorTimer.h"
 #include "util/HFactorDebug.h"
@@ -536,6 +537,11 @@ void HFactor::luClear() {
   u_start.push_back(0);
   u_index.clear();
   u_value.clear();
+
+  l_ftran_levels.clear();
+  l_btran_levels.clear();
+  u_ftran_levels.clear();
+  u_btran_levels.clear();
 }
 
 void HFactor::buildSimple() {
@@ -1093,103 +1099,84 @@ HighsInt HFactor::buildKernel() {
     // 2.4. Loop over pivot row to eliminate other column
     const HighsInt row_start = mr_start[iRowPivot];
     const HighsInt row_end = row_start + mr_count[iRowPivot];
-    for (HighsInt row_k = row_start; row_k < row_end; row_k++) {
-      // 2.4.1. My pointer
-      HighsInt iCol = mr_index[row_k];
-      const HighsInt my_count = mc_count_a[iCol];
-      const HighsInt my_start = mc_start[iCol];
-      const HighsInt my_end = my_start + my_count - 1;
-      double my_pivot = colDelete(iCol, iRowPivot);
-      colStoreN(iCol, iRowPivot, my_pivot);
-
-      // 2.4.2. Elimination on the overlapping part
-      HighsInt nFillin = mwz_column_count;
-      HighsInt nCancel = 0;
-      for (HighsInt my_k = my_start; my_k < my_end; my_k++) {
-        HighsInt iRow = mc_index[my_k];
-        double value = mc_value[my_k];
-        if (mwz_column_mark[iRow]) {
-          mwz_column_mark[iRow] = 0;
-          nFillin--;
-          value -= my_pivot * mwz_column_array[iRow];
-          if (fabs(value) < kHighsTiny) {
-            value = 0;
-            nCancel++;
+    if (parallel_build_ &&
+        mr_count[iRowPivot] >= kBuildKernelParallelMinRowCount &&
+        1.0 * mr_count[iRowPivot] * mwz_column_count >=
+            kBuildKernelParallelMinWork) {
+      buildKernelEliminate(iRowPivot, mwz_column_count, fake_eliminate);
+    } else {
+      for (HighsInt row_k = row_start; row_k < row_end; row_k++) {
+        // 2.4.1. My pointer
+        HighsInt iCol = mr_index[row_k];
+        const HighsInt my_count = mc_count_a[iCol];
+        const HighsInt my_start = mc_start[iCol];
+        const HighsInt my_end = my_start + my_count - 1;
+        double my_pivot = colDelete(iCol, iRowPivot);
+        colStoreN(iCol, iRowPivot, my_pivot);
+
+        // 2.4.2. Elimination on the overlapping part
+        HighsInt nFillin = mwz_column_count;
+        HighsInt nCancel = 0;
+        for (HighsInt my_k = my_start; my_k < my_end; my_k++) {
+          HighsInt iRow = mc_index[my_k];
+          double value = mc_value[my_k];
+          if (mwz_column_mark[iRow]) {
+            mwz_column_mark[iRow] = 0;
+            nFillin--;
+            value -= my_pivot * mwz_column_array[iRow];
+            if (fabs(value) < kHighsTiny) {
+              value = 0;
+              nCancel++;
+            }
+            mc_value[my_k] = value;
           }
-          mc_value[my_k] = value;
         }
-      }
-      fake_eliminate += mwz_column_count;
-      fake_eliminate += nFillin * 2;
-
-      // 2.4.3. Remove cancellation gaps
-      if (nCancel > 0) {
-        HighsInt new_end = my_start;
-        for (HighsInt my_k = my_start; my_k < my_end; my_k++) {
-          if (mc_value[my_k] != 0) {
-            mc_index[new_end] = mc_index[my_k];
-            mc_value[new_end++] = mc_value[my_k];
-          } else {
-            rowDelete(iCol, mc_index[my_k]);
+        fake_eliminate += mwz_column_count;
+        fake_eliminate += nFillin * 2;
+
+        // 2.4.3. Remove cancellation gaps
+        if (nCancel > 0) {
+          HighsInt new_end = my_start;
+          for (HighsInt my_k = my_start; my_k < my_end; my_k++) {
+            if (mc_value[my_k] != 0) {
+              mc_index[new_end] = mc_index[my_k];
+              mc_value[new_end++] = mc_value[my_k];
+            } else {
+              rowDelete(iCol, mc_index[my_k]);
+            }
           }
+          mc_count_a[iCol] = new_end - my_start;
         }
-        mc_count_a[iCol] = new_end - my_start;
-      }
 
-      // 2.4.4. Insert fill-in
-      if (nFillin > 0) {
-        // 2.4.4.1 Check column size
-        if (mc_count_a[iCol] + mc_count_n[iCol] + nFillin > mc_space[iCol]) {
-          // p1&2=active, p3&4=non active, p5=new p1, p7=new p3
-          HighsInt p1 = mc_start[iCol];
-          HighsInt p2 = p1 + mc_count_a[iCol];
-          HighsInt p3 = p1 + mc_space[iCol] - mc_count_n[iCol];
-          HighsInt p4 = p1 + mc_space[iCol];
-          mc_space[iCol] += max(mc_space[iCol], nFillin);
-          HighsInt p5 = mc_start[iCol] = mc_index.size();
-          HighsInt p7 = p5 + mc_space[iCol] - mc_count_n[iCol];
-          mc_index.resize(p5 + mc_space[iCol]);
-          mc_value.resize(p5 + mc_space[iCol]);
-          copy(&mc_index[p1], &mc_index[p2], &mc_index[p5]);
-          copy(&mc_value[p1], &mc_value[p2], &mc_value[p5]);
-          copy(&mc_index[p3], &mc_index[p4], &mc_index[p7]);
-          copy(&mc_value[p3], &mc_value[p4], &mc_value[p7]);
-        }
+        // 2.4.4. Insert fill-in
+        if (nFillin > 0) {
+          // 2.4.4.1 Check column size
+          colReserve(iCol, nFillin);
 
-        // 2.4.4.2 Fill into column copy
-        for (HighsInt i = 0; i < mwz_column_count; i++) {
-          HighsInt iRow = mwz_column_index[i];
-          if (mwz_column_mark[iRow])
-            colInsert(iCol, iRow, -my_pivot * mwz_column_array[iRow]);
-        }
+          // 2.4.4.2 Fill into column copy
+          for (HighsInt i = 0; i < mwz_column_count; i++) {
+            HighsInt iRow = mwz_column_index[i];
+            if (mwz_column_mark[iRow])
+              colInsert(iCol, iRow, -my_pivot * mwz_column_array[iRow]);
+          }
 
-        // 2.4.4.3 Fill into the row copy
-        for (HighsInt i = 0; i < mwz_column_count; i++) {
-          HighsInt iRow = mwz_column_index[i];
-          if (mwz_column_mark[iRow]) {
-            // Expand row space
-            if (mr_count[iRow] == mr_space[iRow]) {
-              HighsInt p1 = mr_start[iRow];
-              HighsInt p2 = p1 + mr_count[iRow];
-              HighsInt p3 = mr_start[iRow] = mr_index.size();
-              mr_space[iRow] *= 2;
-              mr_index.resize(p3 + mr_space[iRow]);
-              copy(&mr_index[p1], &mr_index[p2], &mr_index[p3]);
-            }
-            rowInsert(iCol, iRow);
+          // 2.4.4.3 Fill into the row copy
+          for (HighsInt i = 0; i < mwz_column_count; i++) {
+            HighsInt iRow = mwz_column_index[i];
+            if (mwz_column_mark[iRow]) rowInsertReserve(iCol, iRow);
           }
         }
-      }
 
-      // 2.4.5. Reset pivot column mark
-      for (HighsInt i = 0; i < mwz_column_count; i++)
-        mwz_column_mark[mwz_column_index[i]] = 1;
+        // 2.4.5. Reset pivot column mark
+        for (HighsInt i = 0; i < mwz_column_count; i++)
+          mwz_column_mark[mwz_column_index[i]] = 1;
 
-      // 2.4.6. Fix max value and link list
-      colFixMax(iCol);
-      if (my_count != mc_count_a[iCol]) {
-        clinkDel(iCol);
-        clinkAdd(iCol, mc_count_a[iCol]);
+        // 2.4.6. Fix max value and link list
+        colFixMax(iCol);
+        if (my_count != mc_count_a[iCol]) {
+          clinkDel(iCol);
+          clinkAdd(iCol, mc_count_a[iCol]);
+        }
       }
     }
 
@@ -1212,6 +1199,148 @@ HighsInt HFactor::buildKernel() {
   return rank_deficiency;
 }
 
+void HFactor::colReserve(const HighsInt iCol, const HighsInt num_fill) {
+  if (mc_count_a[iCol] + mc_count_n[iCol] + num_fill <= mc_space[iCol])
+    return;
+  // p1&2=active, p3&4=non active, p5=new p1, p7=new p3
+  HighsInt p1 = mc_start[iCol];
+  HighsInt p2 = p1 + mc_count_a[iCol];
+  HighsInt p3 = p1 + mc_space[iCol] - mc_count_n[iCol];
+  HighsInt p4 = p1 + mc_space[iCol];
+  mc_space[iCol] += max(mc_space[iCol], num_fill);
+  HighsInt p5 = mc_start[iCol] = mc_index.size();
+  HighsInt p7 = p5 + mc_space[iCol] - mc_count_n[iCol];
+  mc_index.resize(p5 + mc_space[iCol]);
+  mc_value.resize(p5 + mc_space[iCol]);
+  copy(&mc_index[p1], &mc_index[p2], &mc_index[p5]);
+  copy(&mc_value[p1], &mc_value[p2], &mc_value[p5]);
+  copy(&mc_index[p3], &mc_index[p4], &mc_index[p7]);
+  copy(&mc_value[p3], &mc_value[p4], &mc_value[p7]);
+}
+
+void HFactor::rowInsertReserve(const HighsInt iCol, const HighsInt iRow) {
+  // Expand row space
+  if (mr_count[iRow] == mr_space[iRow]) {
+    HighsInt p1 = mr_start[iRow];
+    HighsInt p2 = p1 + mr_count[iRow];
+    HighsInt p3 = mr_start[iRow] = mr_index.size();
+    mr_space[iRow] *= 2;
+    mr_index.resize(p3 + mr_space[iRow]);
+    copy(&mr_index[p1], &mr_index[p2], &mr_index[p3]);
+  }
+  rowInsert(iCol, iRow);
+}
+
+void HFactor::buildKernelEliminate(const HighsInt iRowPivot,
+                                   const HighsInt mwz_column_count,
+                                   double& fake_eliminate) {
+  // Eliminates the columns of a long pivotal row in two phases. The
+  // first, performed concurrently, eliminates within the active part
+  // of each column and removes cancellation, since each column is
+  // only modified by its own task. The fill-in and the changes to the
+  // row-wise copy and count link lists are then made serially, in the
+  // same order as buildKernel, so the factors are the same as when
+  // eliminating serially
+  const HighsInt row_start = mr_start[iRowPivot];
+  const HighsInt row_count = mr_count[iRowPivot];
+  const HighsInt num_workspace = highs::parallel::num_threads();
+  if ((HighsInt)kernel_workspace.size() < num_workspace)
+    kernel_workspace.resize(num_workspace);
+  for (KernelWorkspace& workspace : kernel_workspace) {
+    workspace.fill.clear();
+    workspace.cancel.clear();
+  }
+  kernel_column_update.resize(row_count);
+  highs::parallel::for_each(
+      0, row_count,
+      [&](HighsInt from, HighsInt to) {
+        const HighsInt worker = highs::parallel::thread_num();
+        KernelWorkspace& workspace = kernel_workspace[worker];
+        vector<char>& mark = workspace.mark;
+        if ((HighsInt)mark.size() < num_row) mark.assign(num_row, 0);
+        for (HighsInt i = 0; i < mwz_column_count; i++)
+          mark[mwz_column_index[i]] = 1;
+        for (HighsInt k = from; k < to; k++) {
+          const HighsInt iCol = mr_index[row_start + k];
+          KernelColumnUpdate& update = kernel_column_update[k];
+          update.count = mc_count_a[iCol];
+          update.workspace = worker;
+          const HighsInt my_start = mc_start[iCol];
+          const HighsInt my_end = my_start + update.count - 1;
+          const double my_pivot = colDelete(iCol, iRowPivot);
+          colStoreN(iCol, iRowPivot, my_pivot);
+          update.multiplier = my_pivot;
+          // Elimination on the overlapping part
+          HighsInt nCancel = 0;
+          for (HighsInt my_k = my_start; my_k < my_end; my_k++) {
+            HighsInt iRow = mc_index[my_k];
+            double value = mc_value[my_k];
+            if (mark[iRow]) {
+              mark[iRow] = 0;
+              value -= my_pivot * mwz_column_array[iRow];
+              if (fabs(value) < kHighsTiny) {
+                value = 0;
+                nCancel++;
+              }
+              mc_value[my_k] = value;
+            }
+          }
+          // Remove cancellation gaps, recording the rows for the
+          // row-wise copy
+          update.cancel_start = workspace.cancel.size();
+          if (nCancel > 0) {
+            HighsInt new_end = my_start;
+            for (HighsInt my_k = my_start; my_k < my_end; my_k++) {
+              if (mc_value[my_k] != 0) {
+                mc_index[new_end] = mc_index[my_k];
+                mc_value[new_end++] = mc_value[my_k];
+              } else {
+                workspace.cancel.push_back(mc_index[my_k]);
+              }
+            }
+            mc_count_a[iCol] = new_end - my_start;
+          }
+          update.cancel_end = workspace.cancel.size();
+          // Record the fill-in and reset the pivot column mark
+          update.fill_start = workspace.fill.size();
+          for (HighsInt i = 0; i < mwz_column_count; i++) {
+            HighsInt iRow = mwz_column_index[i];
+            if (mark[iRow]) workspace.fill.push_back(iRow);
+            mark[iRow] = 1;
+          }
+          update.fill_end = workspace.fill.size();
+        }
+        for (HighsInt i = 0; i < mwz_column_count; i++)
+          mark[mwz_column_index[i]] = 0;
+      },
+      kBuildKernelParallelGrainSize);
+
+  for (HighsInt k = 0; k < row_count; k++) {
+    const HighsInt iCol = mr_index[row_start + k];
+    const KernelColumnUpdate& update = kernel_column_update[k];
+    const KernelWorkspace& workspace = kernel_workspace[update.workspace];
+    for (HighsInt i = update.cancel_start; i < update.cancel_end; i++)
+      rowDelete(iCol, workspace.cancel[i]);
+    const HighsInt nFillin = update.fill_end - update.fill_start;
+    fake_eliminate += mwz_column_count;
+    fake_eliminate += nFillin * 2;
+    if (nFillin > 0) {
+      colReserve(iCol, nFillin);
+      for (HighsInt i = update.fill_start; i < update.fill_end; i++) {
+        HighsInt iRow = workspace.fill[i];
+        colInsert(iCol, iRow, -update.multiplier * mwz_column_array[iRow]);
+      }
+      for (HighsInt i = update.fill_start; i < update.fill_end; i++)
+        rowInsertReserve(iCol, workspace.fill[i]);
+    }
+    colFixMax(iCol);
+    if (update.count != mc_count_a[iCol]) {
+      clinkDel(iCol);
+      clinkAdd(iCol, mc_count_a[iCol]);
+    }
+  }
+}
+
 void HFactor::buildHandleRankDeficiency() {
   debugReportRankDeficiency(0, highs_debug_level, log_options, num_row, permute,
                             iwork, basic_index, rank_deficiency,
@@ -1451,6 +1580,91 @@ void HFactor::buildFinish() {
     // Add cost of buildFinish to build_synthetic_tick
     build_synthetic_tick += num_row * 80 + (LcountX + u_countX) * 60;
   }
+  buildLevels();
+}
+
+// Groups the first num_pivot pivots of a triangular factor into
+// levels, where pivot i depends on the pivots
+// j=pivot_lookup[index[k]] for k in [start[i], end[i]). Pivots are
+// eliminated in increasing order, or in decreasing order if reverse
+// is true. Void pivots and dependencies on pivots from FT updates are
+// ignored. No levels are formed if they are too narrow to be worth
+// eliminating concurrently
+static void computeLevels(const HighsInt num_pivot, const bool reverse,
+                          const HighsInt* pivot_index,
+                          const HighsInt* pivot_lookup, const HighsInt* start,
+                          const HighsInt* end, const HighsInt* index,
+                          HFactorLevels& levels) {
+  levels.clear();
+  if (num_pivot <= 0) return;
+  std::vector<HighsInt> level(num_pivot, 0);
+  HighsInt num_level = 0;
+  for (HighsInt k = 0; k < num_pivot; k++) {
+    const HighsInt i = reverse ? num_pivot - 1 - k : k;
+    if (pivot_index[i] < 0) continue;
+    HighsInt i_level = 0;
+    for (HighsInt iEl = start[i]; iEl < end[i]; iEl++) {
+      const HighsInt j = pivot_lookup[index[iEl]];
+      if (j < num_pivot) i_level = max(level[j] + 1, i_level);
+    }
+    level[i] = i_level;
+    num_level = max(i_level + 1, num_level);
+  }
+  if (num_level * kLevelSolveMinWidth > num_pivot) return;
+  // Sort the pivots by level, retaining their elimination order
+  // within each level
+  levels.start.assign(num_level + 1, 0);
+  for (HighsInt i = 0; i < num_pivot; i++)
+    if (pivot_index[i] >= 0) levels.start[level[i] + 1]++;
+  for (HighsInt l = 0; l < num_level; l++)
+    levels.start[l + 1] += levels.start[l];
+  levels.pivot.resize(levels.start[num_level]);
+  std::vector<HighsInt> next(levels.start.begin(), levels.start.end() - 1);
+  for (HighsInt k = 0; k < num_pivot; k++) {
+    const HighsInt i = reverse ? num_pivot - 1 - k : k;
+    if (pivot_index[i] >= 0) levels.pivot[next[level[i]]++] = i;
+  }
+}
+
+void HFactor::buildLevels() {
+  l_ftran_levels.clear();
+  l_btran_levels.clear();
+  u_ftran_levels.clear();
+  u_btran_levels.clear();
+  if (!parallel_solve_ || update_method != kUpdateMethodFt) return;
+  // Eliminating a pivot in FTRAN gathers along its row of L or U, and
+  // in BTRAN gathers along its column. Pivots from FT updates are
+  // eliminated serially, so levels are formed for the num_row pivots
+  // of INVERT
+  computeLevels(num_row, false, l_pivot_index.data(), l_pivot_lookup.data(),
+                lr_start.data(), lr_start.data() + 1, lr_index.data(),
+                l_ftran_levels);
+  computeLevels(num_row, true, l_pivot_index.data(), l_pivot_lookup.data(),
+                l_start.data(), l_start.data() + 1, l_index.data(),
+                l_btran_levels);
+  computeLevels(num_row, true, u_pivot_index.data(), u_pivot_lookup.data(),
+                ur_start.data(), ur_lastp.data(), ur_index.data(),
+                u_ftran_levels);
+  computeLevels(num_row, false, u_pivot_index.data(), u_pivot_lookup.data(),
+                u_start.data(), u_last_p.data(), u_index.data(),
+                u_btran_levels);
+}
+
+void HFactor::setParallelBuild(const bool parallel_build) {
+  // Concurrent elimination requires the task scheduler to be running
+  this->parallel_build_ =
+      parallel_build && HighsTaskExecutor::getThisWorkerDeque() != nullptr;
+}
+
+void HFactor::setParallelSolve(const bool parallel_solve) {
+  // Concurrent elimination requires the task scheduler to be running
+  this->parallel_solve_ =
+      parallel_solve && HighsTaskExecutor::getThisWorkerDeque() != nullptr;
+  // Levels are formed by the next INVERT
+  l_ftran_levels.clear();
+  l_btran_levels.clear();
+  u_ftran_levels.clear();
+  u_btran_levels.clear();
 }
 
 void HFactor::zeroCol(const HighsInt jCol) {
@@ -1497,7 +1711,11 @@ void HFactor::ftranL(HVector& rhs, const double expected_density,
   double current_density = 1.0 * rhs.count / num_row;
   const bool sparse_solve = rhs.count < 0 || current_density > kHyperCancel ||
                             expected_density > kHyperFtranL;
-  if (sparse_solve) {
+  if (sparse_solve && useLevelSolve(l_ftran_levels, rhs)) {
+    factor_timer.start(FactorFtranLowerSps, factor_timer_clock_pointer);
+    ftranLLevels(rhs);
+    factor_timer.stop(FactorFtranLowerSps, factor_timer_clock_pointer);
+  } else if (sparse_solve) {
     factor_timer.start(FactorFtranLowerSps, factor_timer_clock_pointer);
     // Alias to RHS
     HighsInt* rhs_index = &rhs.index[0];
@@ -1547,7 +1765,11 @@ void HFactor::btranL(HVector& rhs, const double expected_density,
   const double current_density = 1.0 * rhs.count / num_row;
   const bool sparse_solve = rhs.count < 0 || current_density > kHyperCancel ||
                             expected_density > kHyperBtranL;
-  if (sparse_solve) {
+  if (sparse_solve && useLevelSolve(l_btran_levels, rhs)) {
+    factor_timer.start(FactorBtranLowerSps, factor_timer_clock_pointer);
+    btranLLevels(rhs);
+    factor_timer.stop(FactorBtranLowerSps, factor_timer_clock_pointer);
+  } else if (sparse_solve) {
     factor_timer.start(FactorBtranLowerSps, factor_timer_clock_pointer);
     // Alias to RHS
     HighsInt* rhs_index = &rhs.index[0];
@@ -1626,7 +1848,11 @@ void HFactor::ftranU(HVector& rhs, const double expected_density,
   const double current_density = 1.0 * rhs.count / num_row;
   const bool sparse_solve = rhs.count < 0 || current_density > kHyperCancel ||
                             expected_density > kHyperFtranU;
-  if (sparse_solve) {
+  if (sparse_solve && useLevelSolve(u_ftran_levels, rhs)) {
+    factor_timer.start(FactorFtranUpperSps0, factor_timer_clock_pointer);
+    ftranULevels(rhs);
+    factor_timer.stop(FactorFtranUpperSps0, factor_timer_clock_pointer);
+  } else if (sparse_solve) {
     const bool report_ftran_upper_sparse =
         false;  // current_density < kHyperCancel;
     HighsInt use_clock;
@@ -1735,7 +1961,11 @@ void HFactor::btranU(HVector& rhs, const double expected_density,
   const double current_density = 1.0 * rhs.count / num_row;
   const bool sparse_solve = rhs.count < 0 || current_density > kHyperCancel ||
                             expected_density > kHyperBtranU;
-  if (sparse_solve) {
+  if (sparse_solve && useLevelSolve(u_btran_levels, rhs)) {
+    factor_timer.start(FactorBtranUpperSps, factor_timer_clock_pointer);
+    btranULevels(rhs);
+    factor_timer.stop(FactorBtranUpperSps, factor_timer_clock_pointer);
+  } else if (sparse_solve) {
     factor_timer.start(FactorBtranUpperSps, factor_timer_clock_pointer);
     // Alias to non constant
     double rhs_synthetic_tick = 0;
@@ -1806,6 +2036,131 @@ void HFactor::btranU(HVector& rhs, const double expected_density,
   factor_timer.stop(FactorBtranUpper, factor_timer_clock_pointer);
 }
 
+bool HFactor::useLevelSolve(const HFactorLevels& levels,
+                            const HVector& rhs) const {
+  return parallel_solve_ && levels.numLevel() > 0 &&
+         (rhs.count < 0 || rhs.count > kLevelSolveDensity * num_row);
+}
+
+// Eliminates pivot i of a triangular factor by gathering the products
+// of its entries in [start[i], end[i]) with the RHS, rather than by
+// scattering its multiple of the RHS
+static inline void gatherPivot(const HighsInt i, const HighsInt* pivot_index,
+                               const double* pivot_value,
+                               const HighsInt* start, const HighsInt* end,
+                               const HighsInt* index, const double* value,
+                               double* rhs_array) {
+  const HighsInt pivotRow = pivot_index[i];
+  if (pivotRow < 0) return;
+  double pivot_multiplier = rhs_array[pivotRow];
+  for (HighsInt k = start[i]; k < end[i]; k++)
+    pivot_multiplier -= rhs_array[index[k]] * value[k];
+  if (fabs(pivot_multiplier) > kHighsTiny) {
+    if (pivot_value) pivot_multiplier /= pivot_value[i];
+    rhs_array[pivotRow] = pivot_multiplier;
+  } else
+    rhs_array[pivotRow] = 0;
+}
+
+// Eliminates the pivots of each level concurrently. Since each pivot
+// only writes its own RHS entry, and the sums are formed in the same
+// order, the result is independent of the number of threads
+static void solveLevels(const HFactorLevels& levels,
+                        const HighsInt* pivot_index, const double* pivot_value,
+                        const HighsInt* start, const HighsInt* end,
+                        const HighsInt* index, const double* value,
+                        double* rhs_array) {
+  for (HighsInt l = 0; l < levels.numLevel(); l++)
+    highs::parallel::for_each(
+        levels.start[l], levels.start[l + 1],
+        [&](HighsInt from, HighsInt to) {
+          for (HighsInt k = from; k < to; k++)
+            gatherPivot(levels.pivot[k], pivot_index, pivot_value, start, end,
+                        index, value, rhs_array);
+        },
+        kLevelSolveGrainSize);
+}
+
+void HFactor::ftranLLevels(HVector& rhs) const {
+  double* rhs_array = &rhs.array[0];
+  solveLevels(l_ftran_levels, l_pivot_index.data(), NULL, lr_start.data(),
+              lr_start.data() + 1, lr_index.data(), lr_value.data(),
+              rhs_array);
+  // Index the nonzeros in the order of the serial solve
+  HighsInt rhs_count = 0;
+  for (HighsInt i = 0; i < num_row; i++) {
+    const HighsInt pivotRow = l_pivot_index[i];
+    if (rhs_array[pivotRow]) rhs.index[rhs_count++] = pivotRow;
+  }
+  rhs.count = rhs_count;
+}
+
+void HFactor::btranLLevels(HVector& rhs) const {
+  double* rhs_array = &rhs.array[0];
+  solveLevels(l_btran_levels, l_pivot_index.data(), NULL, l_start.data(),
+              l_start.data() + 1, l_index.data(), l_value.data(), rhs_array);
+  HighsInt rhs_count = 0;
+  for (HighsInt i = num_row - 1; i >= 0; i--) {
+    const HighsInt pivotRow = l_pivot_index[i];
+    if (rhs_array[pivotRow]) rhs.index[rhs_count++] = pivotRow;
+  }
+  rhs.count = rhs_count;
+}
+
+void HFactor::ftranULevels(HVector& rhs) const {
+  double* rhs_array = &rhs.array[0];
+  const HighsInt u_pivot_count = u_pivot_index.size();
+  // Pivots from FT updates are eliminated first, serially, and then
+  // the pivots of INVERT by levels
+  for (HighsInt i_logic = u_pivot_count - 1; i_logic >= num_row; i_logic--)
+    gatherPivot(i_logic, u_pivot_index.data(), u_pivot_value.data(),
+                ur_start.data(), ur_lastp.data(), ur_index.data(),
+                ur_value.data(), rhs_array);
+  solveLevels(u_ftran_levels, u_pivot_index.data(), u_pivot_value.data(),
+              ur_start.data(), ur_lastp.data(), ur_index.data(),
+              ur_value.data(), rhs_array);
+  // Index the nonzeros and accumulate the synthetic tick as in the
+  // serial solve
+  double rhs_synthetic_tick = 0;
+  HighsInt rhs_count = 0;
+  for (HighsInt i_logic = u_pivot_count - 1; i_logic >= 0; i_logic--) {
+    const HighsInt pivotRow = u_pivot_index[i_logic];
+    if (pivotRow < 0 || !rhs_array[pivotRow]) continue;
+    rhs.index[rhs_count++] = pivotRow;
+    if (i_logic >= num_row)
+      rhs_synthetic_tick += u_last_p[i_logic] - u_start[i_logic];
+  }
+  rhs.count = rhs_count;
+  rhs.synthetic_tick +=
+      rhs_synthetic_tick * 15 + (u_pivot_count - num_row) * 10;
+}
+
+void HFactor::btranULevels(HVector& rhs) const {
+  double* rhs_array = &rhs.array[0];
+  const HighsInt u_pivot_count = u_pivot_index.size();
+  // Pivots of INVERT are eliminated first, by levels, and then the
+  // pivots from FT updates, serially
+  solveLevels(u_btran_levels, u_pivot_index.data(), u_pivot_value.data(),
+              u_start.data(), u_last_p.data(), u_index.data(), u_value.data(),
+              rhs_array);
+  for (HighsInt i_logic = num_row; i_logic < u_pivot_count; i_logic++)
+    gatherPivot(i_logic, u_pivot_index.data(), u_pivot_value.data(),
+                u_start.data(), u_last_p.data(), u_index.data(),
+                u_value.data(), rhs_array);
+  double rhs_synthetic_tick = 0;
+  HighsInt rhs_count = 0;
+  for (HighsInt i_logic = 0; i_logic < u_pivot_count; i_logic++) {
+    const HighsInt pivotRow = u_pivot_index[i_logic];
+    if (pivotRow < 0 || !rhs_array[pivotRow]) continue;
+    rhs.index[rhs_count++] = pivotRow;
+    if (i_logic >= num_row)
+      rhs_synthetic_tick += ur_lastp[i_logic] - ur_start[i_logic];
+  }
+  rhs.count = rhs_count;
+  rhs.synthetic_tick +=
+      rhs_synthetic_tick * 15 + (u_pivot_count - num_row) * 10;
+}
+
 void HFactor::ftranFT(HVector& vector) const {
   // Alias to non constant
   assert(vector.count >= 0);
@@ -2537,6 +2892,12 @@ void HFactor::setInvert(const InvertibleRepresentation& invert) {
   this->pf_value = invert.pf_value;
   this->pf_pivot_index = invert.pf_pivot_index;
   this->pf_pivot_value = invert.pf_pivot_value;
+  buildLevels();
+}
+
+void HFactorLevels::clear() {
+  this->start.clear();
+  this->pivot.clear();
 }
 
 void InvertibleRepresentation::clear() {
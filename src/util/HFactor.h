@@ -67,6 +67,19 @@ struct InvertibleRepresentation {
   void clear();
 };
 
+/**
+ * @brief Pivots of a triangular factor grouped into levels, so that
+ * the pivots in each level depend only on pivots in earlier levels
+ * and can be eliminated concurrently. Level l consists of the pivot
+ * positions pivot[start[l]] to pivot[start[l+1]-1]
+ */
+struct HFactorLevels {
+  std::vector<HighsInt> start;
+  std::vector<HighsInt> pivot;
+  HighsInt numLevel() const { return start.empty() ? 0 : start.size() - 1; }
+  void clear();
+};
+
 /**
  * @brief Basis matrix factorization, update and solves for HiGHS
  *
@@ -299,6 +312,20 @@ class HFactor {
     this->debug_report_ = debug_report;
   }
 
+  /**
+   * @brief Sets whether buildKernel eliminates the columns of long
+   * pivotal rows concurrently. The factors are the same as when
+   * eliminating serially
+   */
+  void setParallelBuild(const bool parallel_build);
+
+  /**
+   * @brief Sets whether dense FTRAN and BTRAN with the FT update
+   * eliminate the pivots of each level of L and U concurrently. Takes
+   * effect from the next call to build()
+   */
+  void setParallelSolve(const bool parallel_solve);
+
   // Information required to perform refactorization of the current
   // basis
   RefactorInfo refactor_info_;
@@ -339,6 +366,8 @@ class HFactor {
 
   bool use_original_HFactor_logic;
   bool debug_report_ = false;
+  bool parallel_build_ = false;
+  bool parallel_solve_ = false;
   HighsInt basis_matrix_limit_size;
   HighsInt update_method;
 
@@ -378,6 +407,27 @@ class HFactor {
   vector<char> mwz_column_mark;
   vector<double> mwz_column_array;
 
+  // Workspace for eliminating the columns of a long pivotal row
+  // concurrently in buildKernel. Each worker has its own pivot column
+  // mark, and records the fill-in and cancelled rows of the columns it
+  // eliminates, to be applied serially
+  struct KernelWorkspace {
+    vector<char> mark;
+    vector<HighsInt> fill;
+    vector<HighsInt> cancel;
+  };
+  struct KernelColumnUpdate {
+    HighsInt count;
+    double multiplier;
+    HighsInt workspace;
+    HighsInt fill_start;
+    HighsInt fill_end;
+    HighsInt cancel_start;
+    HighsInt cancel_end;
+  };
+  vector<KernelWorkspace> kernel_workspace;
+  vector<KernelColumnUpdate> kernel_column_update;
+
   // Count link list
   vector<HighsInt> col_link_first;
   vector<HighsInt> col_link_next;
@@ -422,16 +472,29 @@ class HFactor {
   vector<HighsInt> pf_index;
   vector<double> pf_value;
 
+  // Levels of the L and U factors from INVERT, used when
+  // parallel_solve_ is set
+  HFactorLevels l_ftran_levels;
+  HFactorLevels l_btran_levels;
+  HFactorLevels u_ftran_levels;
+  HFactorLevels u_btran_levels;
+
   HVector rhs_;
 
   // Implementation
   void buildSimple();
   //    void buildKernel();
   HighsInt buildKernel();
+  void buildKernelEliminate(const HighsInt iRowPivot,
+                            const HighsInt mwz_column_count,
+                            double& fake_eliminate);
+  void colReserve(const HighsInt iCol, const HighsInt num_fill);
+  void rowInsertReserve(const HighsInt iCol, const HighsInt iRow);
   void buildHandleRankDeficiency();
   void buildReportRankDeficiency();
   void buildMarkSingC();
   void buildFinish();
+  void buildLevels();
   void zeroCol(const HighsInt iCol);
   void luClear();
   // Rebuild using refactor information
@@ -454,6 +517,12 @@ class HFactor {
   void btranU(HVector& vector, const double expected_density,
               HighsTimerClock* factor_timer_clock_pointer = NULL) const;
 
+  bool useLevelSolve(const HFactorLevels& levels, const HVector& rhs) const;
+  void ftranLLevels(HVector& rhs) const;
+  void btranLLevels(HVector& rhs) const;
+  void ftranULevels(HVector& rhs) const;
+  void btranULevels(HVector& rhs) const;
+
   void ftranFT(HVector& vector) const;
   void btranFT(HVector& vector) const;
   void ftranPF(HVector& vector) const;
@@ -54,6 +54,23 @@ const double kHyperCancel = 0.05;
  * hyper-sparse - only for reporting
  */
 const double kHyperResult = 0.10;
+/**
+ * Thresholds for level-scheduled TRANs: the minimum RHS density, the
+ * minimum mean number of pivots in a level, and the number of pivots
+ * eliminated by each task
+ */
+const double kLevelSolveDensity = 0.10;
+const HighsInt kLevelSolveMinWidth = 64;
+const HighsInt kLevelSolveGrainSize = 256;
+/**
+ * Thresholds for eliminating the columns of a pivotal row
+ * concurrently in INVERT: the minimum row count, the minimum product
+ * of the row and column counts, and the number of columns eliminated
+ * by each task
+ */
+const HighsInt kBuildKernelParallelMinRowCount = 16;
+const double kBuildKernelParallelMinWork = 4096;
+const HighsInt kBuildKernelParallelGrainSize = 4;
 
 /**
  * Parameters for reinversion on synthetic clock
@@ -229,5 +229,6 @@ void HFactor::addRows(const HighsSparseMatrix* ar_matrix) {
   //
   // Increase the number of rows in HFactor
   num_row += num_new_row;
+  buildLevels();
   //  reportLu(kReportLuBoth, true);
 }
@@ -22,6 +22,7 @@
 #include <functional>
 #include <iterator>
 #include <memory>
+#include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -677,6 +678,10 @@ struct HighsHashHelpers {
     return vector_hash(val.data(), val.size());
   }
 
+  static u64 hash(const std::string& val) {
+    return vector_hash(val.data(), val.size());
+  }
+
   template <typename T, typename std::enable_if<
                             std::is_same<decltype(*reinterpret_cast<T*>(0) ==
                                                   *reinterpret_cast<T*>(0)),
@@ -955,7 +960,10 @@ class HighsHashTable {
     makeEmptyTable(2 * oldCapactiy);
 
     for (u64 i = 0; i != oldCapactiy; ++i)
-      if (occupied(oldMetadata[i])) insert(std::move(oldEntries.get()[i]));
+      if (occupied(oldMetadata[i])) {
+        insert(std::move(oldEntries.get()[i]));
+        oldEntries.get()[i].~Entry();
+      }
   }
 
   void shrinkTable() {
@@ -966,7 +974,10 @@ class HighsHashTable {
     makeEmptyTable(oldCapactiy / 2);
 
     for (u64 i = 0; i != oldCapactiy; ++i)
-      if (occupied(oldMetadata[i])) insert(std::move(oldEntries.get()[i]));
+      if (occupied(oldMetadata[i])) {
+        insert(std::move(oldEntries.get()[i]));
+        oldEntries.get()[i].~Entry();
+      }
   }
 
   bool findPosition(const KeyType& key, u8& meta, u64& startPos, u64& maxPos,
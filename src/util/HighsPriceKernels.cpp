@@ -0,0 +1,279 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file util/HighsPriceKernels.cpp
+ * @brief
+ */
+#include "util/HighsPriceKernels.h"
+
+#include <cmath>
+#include <cstdint>
+
+#include "lp_data/HConst.h"
+
+#ifdef HIGHS_HAVE_AVX_DISPATCH
+#include <immintrin.h>
+#endif
+
+// Columns and rows with fewer nonzeros than this are priced by the
+// scalar loops, since the gathers of the vectorised kernels are then
+// slower. For columns, this also gives the same result as the scalar
+// kernel.
+const HighsInt kMinVectorisedLength = 8;
+
+static double dotScalar(const HighsInt from_iEl, const HighsInt to_iEl,
+                        const HighsInt* index, const double* value,
+                        const double* x) {
+  double result = 0;
+  for (HighsInt iEl = from_iEl; iEl < to_iEl; iEl++)
+    result += x[index[iEl]] * value[iEl];
+  return result;
+}
+
+static void addRowScalar(const HighsInt from_iEl, const HighsInt to_iEl,
+                         const HighsInt* index, const double* value,
+                         const double multiplier, double* result) {
+  for (HighsInt iEl = from_iEl; iEl < to_iEl; iEl++) {
+    HighsInt iCol = index[iEl];
+    double value0 = result[iCol];
+    double value1 = value0 + multiplier * value[iEl];
+    result[iCol] = (fabs(value1) < kHighsTiny) ? kHighsZero : value1;
+  }
+}
+
+#ifdef HIGHS_HAVE_AVX_DISPATCH
+
+#define HIGHS_TARGET_AVX2 __attribute__((target("avx2")))
+#define HIGHS_TARGET_AVX512 __attribute__((target("avx512f")))
+
+// AVX2 kernels, with 4 values per vector
+
+HIGHS_TARGET_AVX2 static inline __m256d gatherAvx2(const double* x,
+                                                   const HighsInt* index) {
+#ifdef HIGHSINT64
+  return _mm256_i64gather_pd(
+      x, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(index)), 8);
+#else
+  return _mm256_i32gather_pd(
+      x, _mm_loadu_si128(reinterpret_cast<const __m128i*>(index)), 8);
+#endif
+}
+
+HIGHS_TARGET_AVX2 static double dotAvx2(const HighsInt from_iEl,
+                                        const HighsInt to_iEl,
+                                        const HighsInt* index,
+                                        const double* value,
+                                        const double* x) {
+  __m256d sum = _mm256_setzero_pd();
+  HighsInt iEl = from_iEl;
+  for (; iEl + 4 <= to_iEl; iEl += 4)
+    sum = _mm256_add_pd(sum, _mm256_mul_pd(gatherAvx2(x, index + iEl),
+                                           _mm256_loadu_pd(value + iEl)));
+  __m128d sum2 = _mm_add_pd(_mm256_castpd256_pd128(sum),
+                            _mm256_extractf128_pd(sum, 1));
+  double result = _mm_cvtsd_f64(_mm_add_sd(sum2, _mm_unpackhi_pd(sum2, sum2)));
+  for (; iEl < to_iEl; iEl++) result += x[index[iEl]] * value[iEl];
+  return result;
+}
+
+HIGHS_TARGET_AVX2 static void addRowAvx2(const HighsInt from_iEl,
+                                         const HighsInt to_iEl,
+                                         const HighsInt* index,
+                                         const double* value,
+                                         const double multiplier,
+                                         double* result) {
+  const __m256d mult = _mm256_set1_pd(multiplier);
+  const __m256d tiny = _mm256_set1_pd(kHighsTiny);
+  const __m256d zero = _mm256_set1_pd(kHighsZero);
+  const __m256d abs_mask =
+      _mm256_castsi256_pd(_mm256_set1_epi64x(INT64_C(0x7fffffffffffffff)));
+  alignas(32) double value1[4];
+  HighsInt iEl = from_iEl;
+  for (; iEl + 4 <= to_iEl; iEl += 4) {
+    // Without a scatter instruction, the values are stored in turn
+    __m256d v = _mm256_add_pd(
+        gatherAvx2(result, index + iEl),
+        _mm256_mul_pd(mult, _mm256_loadu_pd(value + iEl)));
+    __m256d small =
+        _mm256_cmp_pd(_mm256_and_pd(v, abs_mask), tiny, _CMP_LT_OQ);
+    _mm256_store_pd(value1, _mm256_blendv_pd(v, zero, small));
+    for (HighsInt k = 0; k < 4; k++) result[index[iEl + k]] = value1[k];
+  }
+  addRowScalar(iEl, to_iEl, index, value, multiplier, result);
+}
+
+// AVX-512 kernels, with 8 values per vector and masks for the
+// remaining values
+
+HIGHS_TARGET_AVX512 static inline __m512d gatherAvx512(const double* x,
+                                                       const HighsInt* index,
+                                                       const __mmask8 mask) {
+#ifdef HIGHSINT64
+  __m512i idx = _mm512_maskz_loadu_epi64(mask, index);
+  return _mm512_mask_i64gather_pd(_mm512_setzero_pd(), mask, idx, x, 8);
+#else
+  __m256i idx =
+      _mm512_castsi512_si256(_mm512_maskz_loadu_epi32(__mmask16(mask), index));
+  return _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mask, idx, x, 8);
+#endif
+}
+
+HIGHS_TARGET_AVX512 static inline void scatterAvx512(double* x,
+                                                     const HighsInt* index,
+                                                     const __mmask8 mask,
+                                                     const __m512d v) {
+#ifdef HIGHSINT64
+  __m512i idx = _mm512_maskz_loadu_epi64(mask, index);
+  _mm512_mask_i64scatter_pd(x, mask, idx, v, 8);
+#else
+  __m256i idx =
+      _mm512_castsi512_si256(_mm512_maskz_loadu_epi32(__mmask16(mask), index));
+  _mm512_mask_i32scatter_pd(x, mask, idx, v, 8);
+#endif
+}
+
+HIGHS_TARGET_AVX512 static double dotAvx512(const HighsInt from_iEl,
+                                            const HighsInt to_iEl,
+                                            const HighsInt* index,
+                                            const double* value,
+                                            const double* x) {
+  __m512d sum = _mm512_setzero_pd();
+  for (HighsInt iEl = from_iEl; iEl < to_iEl; iEl += 8) {
+    const HighsInt count = to_iEl - iEl;
+    const __mmask8 mask = count >= 8 ? 0xff : (1u << count) - 1;
+    __m512d product = _mm512_mul_pd(gatherAvx512(x, index + iEl, mask),
+                                    _mm512_maskz_loadu_pd(mask, value + iEl));
+    sum = _mm512_add_pd(sum, product);
+  }
+  return _mm512_reduce_add_pd(sum);
+}
+
+HIGHS_TARGET_AVX512 static void addRowAvx512(const HighsInt from_iEl,
+                                             const HighsInt to_iEl,
+                                             const HighsInt* index,
+                                             const double* value,
+                                             const double multiplier,
+                                             double* result) {
+  const __m512d mult = _mm512_set1_pd(multiplier);
+  const __m512d tiny = _mm512_set1_pd(kHighsTiny);
+  const __m512d zero = _mm512_set1_pd(kHighsZero);
+  for (HighsInt iEl = from_iEl; iEl < to_iEl; iEl += 8) {
+    const HighsInt count = to_iEl - iEl;
+    const __mmask8 mask = count >= 8 ? 0xff : (1u << count) - 1;
+    __m512d v = _mm512_add_pd(
+        gatherAvx512(result, index + iEl, mask),
+        _mm512_mul_pd(mult, _mm512_maskz_loadu_pd(mask, value + iEl)));
+    __mmask8 small =
+        _mm512_cmp_pd_mask(_mm512_abs_pd(v), tiny, _CMP_LT_OQ);
+    scatterAvx512(result, index + iEl, mask,
+                  _mm512_mask_blend_pd(small, v, zero));
+  }
+}
+
+#endif
+
+HighsSimdLevel highsSimdLevel() {
+  static const HighsSimdLevel level = []() {
+#ifdef HIGHS_HAVE_AVX_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return HighsSimdLevel::kAvx512;
+    if (__builtin_cpu_supports("avx2")) return HighsSimdLevel::kAvx2;
+#endif
+    return HighsSimdLevel::kScalar;
+  }();
+  return level;
+}
+
+const char* highsSimdLevelName(const HighsSimdLevel level) {
+  switch (level) {
+    case HighsSimdLevel::kAvx2:
+      return "AVX2";
+    case HighsSimdLevel::kAvx512:
+      return "AVX-512";
+    default:
+      return "scalar";
+  }
+}
+
+// Instantiates a column-wise PRICE loop with the given dot product
+template <typename Dot>
+static HighsInt priceByColumn(const HighsInt num_col, const HighsInt* start,
+                              const HighsInt* index, const double* value,
+                              const double* x, double* result_array,
+                              HighsInt* result_index, Dot dot) {
+  HighsInt count = 0;
+  for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+    const HighsInt from_iEl = start[iCol];
+    const HighsInt to_iEl = start[iCol + 1];
+    double value1 = to_iEl - from_iEl < kMinVectorisedLength
+                        ? dotScalar(from_iEl, to_iEl, index, value, x)
+                        : dot(from_iEl, to_iEl, index, value, x);
+    if (fabs(value1) > kHighsTiny) {
+      result_array[iCol] = value1;
+      result_index[count++] = iCol;
+    }
+  }
+  return count;
+}
+
+HighsInt highsPriceByColumn(const HighsSimdLevel level, const HighsInt num_col,
+                            const HighsInt* start, const HighsInt* index,
+                            const double* value, const double* x,
+                            double* result_array, HighsInt* result_index) {
+#ifdef HIGHS_HAVE_AVX_DISPATCH
+  if (level == HighsSimdLevel::kAvx512)
+    return priceByColumn(num_col, start, index, value, x, result_array,
+                         result_index, dotAvx512);
+  if (level == HighsSimdLevel::kAvx2)
+    return priceByColumn(num_col, start, index, value, x, result_array,
+                         result_index, dotAvx2);
+#endif
+  return priceByColumn(num_col, start, index, value, x, result_array,
+                       result_index, dotScalar);
+}
+
+// Instantiates a row-wise PRICE loop with the given row update
+template <typename AddRow>
+static void priceByRowDenseResult(const HighsInt num_row,
+                                  const HighsInt* row_index,
+                                  const double* multiplier,
+                                  const HighsInt* start, const HighsInt* end,
+                                  const HighsInt* index, const double* value,
+                                  double* result, AddRow addRow) {
+  for (HighsInt ix = 0; ix < num_row; ix++) {
+    const HighsInt iRow = row_index[ix];
+    if (end[iRow] - start[iRow] < kMinVectorisedLength)
+      addRowScalar(start[iRow], end[iRow], index, value, multiplier[iRow],
+                   result);
+    else
+      addRow(start[iRow], end[iRow], index, value, multiplier[iRow], result);
+  }
+}
+
+void highsPriceByRowDenseResult(const HighsSimdLevel level,
+                                const HighsInt num_row,
+                                const HighsInt* row_index,
+                                const double* multiplier,
+                                const HighsInt* start, const HighsInt* end,
+                                const HighsInt* index, const double* value,
+                                double* result) {
+#ifdef HIGHS_HAVE_AVX_DISPATCH
+  if (level == HighsSimdLevel::kAvx512)
+    return priceByRowDenseResult(num_row, row_index, multiplier, start, end,
+                                 index, value, result, addRowAvx512);
+  if (level == HighsSimdLevel::kAvx2)
+    return priceByRowDenseResult(num_row, row_index, multiplier, start, end,
+                                 index, value, result, addRowAvx2);
+#endif
+  priceByRowDenseResult(num_row, row_index, multiplier, start, end, index,
+                        value, result, addRowScalar);
+}
@@ -0,0 +1,55 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2022 at the University of Edinburgh    */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/*    Authors: Julian Hall, Ivet Galabova, Leona Gottwald and Michael    */
+/*    Feldmeier                                                          */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file util/HighsPriceKernels.h
+ * @brief Kernels for PRICE in HighsSparseMatrix, vectorised with AVX2 or
+ * AVX-512 when both the build and the CPU support them
+ */
+#ifndef UTIL_HIGHSPRICEKERNELS_H_
+#define UTIL_HIGHSPRICEKERNELS_H_
+
+#include "util/HighsInt.h"
+
+enum class HighsSimdLevel { kScalar = 0, kAvx2, kAvx512 };
+
+// Returns the most capable instruction set for which kernels are
+// available, determined on the first call
+HighsSimdLevel highsSimdLevel();
+
+const char* highsSimdLevelName(const HighsSimdLevel level);
+
+// For each column of the column-wise matrix (start, index, value),
+// forms the dot product with the dense vector x. Values exceeding
+// kHighsTiny in magnitude are stored in result_array and indexed by
+// result_index, and their number is returned. The vectorised kernels
+// sum the products in a different order, so may differ from the
+// scalar kernel by round-off.
+HighsInt highsPriceByColumn(const HighsSimdLevel level, const HighsInt num_col,
+                            const HighsInt* start, const HighsInt* index,
+                            const double* value, const double* x,
+                            double* result_array, HighsInt* result_index);
+
+// For each of the num_row rows in row_index, adds the row of the
+// row-wise matrix (start, end, index, value) multiplied by
+// multiplier[iRow] to the dense result, replacing values less than
+// kHighsTiny in magnitude by kHighsZero. Since the column indices in a
+// row are distinct, the vectorised kernels give the same result as the
+// scalar kernel.
+void highsPriceByRowDenseResult(const HighsSimdLevel level,
+                                const HighsInt num_row,
+                                const HighsInt* row_index,
+                                const double* multiplier,
+                                const HighsInt* start, const HighsInt* end,
+                                const HighsInt* index, const double* value,
+                                double* result);
+
+#endif /* UTIL_HIGHSPRICEKERNELS_H_ */
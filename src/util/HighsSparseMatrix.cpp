@@ -21,6 +21,7 @@
 
 #include "util/HighsCDouble.h"
 #include "util/HighsMatrixUtils.h"
+#include "util/HighsPriceKernels.h"
 #include "util/HighsSort.h"
 #include "util/HighsSparseVectorSum.h"
 
@@ -1189,19 +1190,20 @@ void HighsSparseMatrix::priceByColumn(const bool quad_precision,
   if (debug_report >= kDebugReportAll)
     printf("\nHighsSparseMatrix::priceByColumn:\n");
   result.count = 0;
+  if (!quad_precision) {
+    // Use the vectorised dot products if available
+    result.count = highsPriceByColumn(
+        highsSimdLevel(), this->num_col_, this->start_.data(),
+        this->index_.data(), this->value_.data(), column.array.data(),
+        result.array.data(), result.index.data());
+    return;
+  }
   for (HighsInt iCol = 0; iCol < this->num_col_; iCol++) {
-    double value = 0;
-    if (quad_precision) {
-      HighsCDouble quad_value = 0.0;
-      for (HighsInt iEl = this->start_[iCol]; iEl < this->start_[iCol + 1];
-           iEl++)
-        quad_value += column.array[this->index_[iEl]] * this->value_[iEl];
-      value = (double)quad_value;
-    } else {
-      for (HighsInt iEl = this->start_[iCol]; iEl < this->start_[iCol + 1];
-           iEl++)
-        value += column.array[this->index_[iEl]] * this->value_[iEl];
-    }
+    HighsCDouble quad_value = 0.0;
+    for (HighsInt iEl = this->start_[iCol]; iEl < this->start_[iCol + 1];
+         iEl++)
+      quad_value += column.array[this->index_[iEl]] * this->value_[iEl];
+    double value = (double)quad_value;
     if (fabs(value) > kHighsTiny) {
       result.array[iCol] = value;
       result.index[result.count++] = iCol;
@@ -1400,6 +1402,19 @@ void HighsSparseMatrix::priceByRowDenseResult(
   // Assumes that result is zeroed beforehand - in case continuing
   // priceByRow after switch from sparse
   assert(this->isRowwise());
+  if (debug_report == kDebugReportOff) {
+    // Use the vectorised row updates if available. Either p_end_ or
+    // the next start_ ends each row
+    const HighsInt* end = this->format_ == MatrixFormat::kRowwisePartitioned
+                              ? this->p_end_.data()
+                              : this->start_.data() + 1;
+    highsPriceByRowDenseResult(highsSimdLevel(), column.count - from_index,
+                               column.index.data() + from_index,
+                               column.array.data(), this->start_.data(), end,
+                               this->index_.data(), this->value_.data(),
+                               result.data());
+    return;
+  }
   for (HighsInt ix = from_index; ix < column.count; ix++) {
     HighsInt iRow = column.index[ix];
     double multiplier = column.array[iRow];